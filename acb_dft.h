@@ -36,11 +36,15 @@ void acb_dft_prod(acb_ptr w, acb_srcptr v, slong * cyc, slong num, slong prec);
 
 void acb_dft_rad2_inplace_threaded(acb_ptr v, int e, slong prec);
 
+void acb_dft_rad2_fixed(acb_ptr w, acb_srcptr v, int e, slong prec);
+void acb_dft_fixed(acb_ptr w, acb_srcptr v, slong len, slong prec);
+
 void acb_dft_convol_naive(acb_ptr w, acb_srcptr f, acb_srcptr g, slong len, slong prec);
 void acb_dft_convol_dft(acb_ptr w, acb_srcptr f, acb_srcptr g, slong len, slong prec);
 void acb_dft_convol_rad2(acb_ptr w, acb_srcptr f, acb_srcptr g, slong len, slong prec);
 void acb_dft_convol_mullow(acb_ptr w, acb_srcptr f, acb_srcptr g, slong len, slong prec);
 void acb_dft_convol(acb_ptr w, acb_srcptr f, acb_srcptr g, slong len, slong prec);
+void acb_dft_convol_many(acb_ptr w, slong wstride, acb_srcptr f, slong fstride, acb_srcptr g, slong len, slong num, slong prec);
 
 #define CRT_MAX 15
 typedef struct
@@ -137,6 +141,7 @@ typedef struct
 {
     slong n;
     int type;
+    slong prec; /* precision of the roots of unity */
     union
     {
         acb_dft_rad2_t rad2;
@@ -182,6 +187,8 @@ void acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slon
 
 void acb_dft_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec);
 void acb_dft_inverse_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec);
+void acb_dft_precomp_many(acb_ptr w, slong wstride, acb_srcptr v, slong vstride, slong num, const acb_dft_pre_t pre, slong prec);
+void acb_dft_inverse_precomp_many(acb_ptr w, slong wstride, acb_srcptr v, slong vstride, slong num, const acb_dft_pre_t pre, slong prec);
 void acb_dft_naive_precomp(acb_ptr w, acb_srcptr v, const acb_dft_naive_t pol, slong prec);
 void acb_dft_cyc_precomp(acb_ptr w, acb_srcptr v, const acb_dft_cyc_t cyc, slong prec);
 
@@ -193,6 +200,9 @@ void acb_dft_bluestein_precomp(acb_ptr w, acb_srcptr v, const acb_dft_bluestein_
 
 void acb_dft_rad2_precomp_inplace_threaded(acb_ptr v, const acb_dft_rad2_t rad2, slong prec);
 
+void acb_dft_rad2_precomp_fixed(acb_ptr w, acb_srcptr v, const acb_dft_rad2_t rad2, slong prec);
+void acb_dft_bluestein_precomp_fixed(acb_ptr w, acb_srcptr v, const acb_dft_bluestein_t t, slong prec);
+
 void acb_dft_inverse_rad2_precomp_inplace(acb_ptr v, const acb_dft_rad2_t rad2, slong prec);
 void acb_dft_inverse_rad2_precomp(acb_ptr w, acb_srcptr v, const acb_dft_rad2_t rad2, slong prec);
 void acb_dft_convol_rad2_precomp(acb_ptr w, acb_srcptr f, acb_srcptr g, slong len, const acb_dft_rad2_t, slong prec);
@@ -204,6 +214,17 @@ void acb_dft_precomp_clear(acb_dft_pre_t pre);
 void acb_dft(acb_ptr w, acb_srcptr v, slong len, slong prec);
 void acb_dft_inverse(acb_ptr w, acb_srcptr v, slong len, slong prec);
 
+int acb_dft_precomp_dump_file(FILE * stream, const acb_dft_pre_t pre);
+int acb_dft_precomp_load_file(acb_dft_pre_t pre, FILE * stream);
+
+#define ACB_DFT_CACHE_NUM 8
+
+void acb_dft_cache_set_enabled(int enabled);
+int acb_dft_cache_enabled(void);
+void acb_dft_cache_clear(void);
+void acb_dft_cache_add(acb_dft_pre_t pre, slong prec);
+const acb_dft_pre_struct * acb_dft_precomp_cached(slong len, slong prec);
+
 acb_dft_step_ptr _acb_dft_steps_prod(slong * m, slong num, slong prec);
 
 ACB_DFT_INLINE void
@@ -9,9 +9,61 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_dft.h"
 #include "acb_modular.h"
 
+/* number of pointwise products per thread task */
+#define BLUESTEIN_CHUNK 256
+
+typedef struct
+{
+    acb_ptr z;
+    acb_srcptr x;
+    acb_srcptr y;
+    slong step;
+    slong len;
+    slong prec;
+}
+_acb_dft_kron_work_t;
+
+static void
+_acb_dft_kron_worker(slong i, _acb_dft_kron_work_t * w)
+{
+    slong k0, k1;
+
+    k0 = i * BLUESTEIN_CHUNK;
+    k1 = FLINT_MIN(k0 + BLUESTEIN_CHUNK, w->len);
+
+    _acb_vec_kronecker_mul_step(w->z + k0, w->x + k0, w->y + k0 * w->step,
+        w->step, k1 - k0, w->prec);
+}
+
+/* z[k] = x[k] y[k * step], distributed over threads */
+static void
+_acb_vec_kronecker_mul_step_threaded(acb_ptr z, acb_srcptr x, acb_srcptr y,
+    slong step, slong len, slong prec)
+{
+    if (len < 2 * BLUESTEIN_CHUNK || flint_get_num_threads() == 1)
+    {
+        _acb_vec_kronecker_mul_step(z, x, y, step, len, prec);
+    }
+    else
+    {
+        _acb_dft_kron_work_t work;
+
+        work.z = z;
+        work.x = x;
+        work.y = y;
+        work.step = step;
+        work.len = len;
+        work.prec = prec;
+
+        flint_parallel_do((do_func_t) _acb_dft_kron_worker, &work,
+            (len + BLUESTEIN_CHUNK - 1) / BLUESTEIN_CHUNK, -1, FLINT_PARALLEL_UNIFORM);
+    }
+}
+
 /* z[k] = z^(k^2), z a 2n-th root of unity */
 static void
 _acb_vec_bluestein_factors(acb_ptr z, slong n, slong prec)
@@ -127,16 +179,16 @@ acb_dft_bluestein_precomp(acb_ptr w, acb_srcptr v, const acb_dft_bluestein_t t,
         return;
 
     fp = _acb_vec_init(np);
-    _acb_vec_kronecker_mul_step(fp, t->z, v, dv, n, prec);
+    _acb_vec_kronecker_mul_step_threaded(fp, t->z, v, dv, n, prec);
 
     acb_dft_rad2_precomp_inplace(fp, t->rad2, prec);
-    _acb_vec_kronecker_mul(fp, t->g, fp, np, prec);
+    _acb_vec_kronecker_mul_step_threaded(fp, t->g, fp, 1, np, prec);
 
     acb_dft_inverse_rad2_precomp_inplace(fp, t->rad2, prec);
 
-    _acb_vec_kronecker_mul(w, t->z, fp, n, prec);
+    _acb_vec_kronecker_mul_step_threaded(w, t->z, fp, 1, n, prec);
 
-    _acb_vec_clear(fp, n);
+    _acb_vec_clear(fp, np);
 }
 
 void
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_dft.h"
 
 static int use_dft(slong len, slong prec)
@@ -33,3 +34,128 @@ void acb_dft_convol(acb_ptr w, acb_srcptr f, acb_srcptr g, slong len, slong prec
     else
         acb_dft_convol_rad2(w, f, g, len, prec);
 }
+
+/*
+Batched convolution: the same g is convolved with num vectors f.
+The transform of g is computed once and shared; each vector is then
+handled by one task with its own temporary, which keeps the working set
+of a task small and lets the batch scale over threads.
+*/
+
+typedef struct
+{
+    acb_ptr w;
+    slong wstride;
+    acb_srcptr f;
+    slong fstride;
+    acb_srcptr gt;
+    slong len;
+    const acb_dft_pre_struct * pre;
+    const acb_dft_rad2_struct * rad2;
+    slong prec;
+}
+_acb_dft_convol_many_work_t;
+
+static void
+_acb_dft_convol_many_worker(slong i, _acb_dft_convol_many_work_t * work)
+{
+    acb_ptr w = work->w + i * work->wstride;
+    acb_srcptr f = work->f + i * work->fstride;
+    slong k, len = work->len, prec = work->prec;
+    acb_ptr fp;
+
+    if (work->pre != NULL)
+    {
+        fp = _acb_vec_init(len);
+        acb_dft_precomp(fp, f, work->pre, prec);
+        _acb_vec_kronecker_mul(fp, fp, work->gt, len, prec);
+        acb_dft_inverse_precomp(w, fp, work->pre, prec);
+        _acb_vec_clear(fp, len);
+    }
+    else
+    {
+        slong np = work->rad2->n;
+
+        fp = _acb_vec_init(np);
+
+        /* wrap f around as in acb_dft_convol_pad */
+        for (k = 0; k < len; k++)
+            acb_set(fp + k, f + k);
+        if (len != np)
+            for (k = 1; k < len; k++)
+                acb_set(fp + np - k, f + len - k);
+
+        acb_dft_rad2_precomp_inplace(fp, work->rad2, prec);
+        _acb_vec_kronecker_mul(fp, fp, work->gt, np, prec);
+        acb_dft_inverse_rad2_precomp_inplace(fp, work->rad2, prec);
+
+        _acb_vec_set(w, fp, len);
+        _acb_vec_clear(fp, np);
+    }
+}
+
+void
+acb_dft_convol_many(acb_ptr w, slong wstride, acb_srcptr f, slong fstride,
+    acb_srcptr g, slong len, slong num, slong prec)
+{
+    _acb_dft_convol_many_work_t work;
+    acb_dft_pre_t pre;
+    acb_dft_rad2_t rad2;
+    acb_ptr gt;
+    slong i, n;
+    int e;
+
+    if (len <= 0 || num <= 0)
+        return;
+
+    if (use_dft(len, prec))
+    {
+        acb_dft_precomp_init(pre, len, prec);
+        n = len;
+        gt = _acb_vec_init(n);
+        acb_dft_precomp(gt, g, pre, prec);
+        work.pre = pre;
+        work.rad2 = NULL;
+    }
+    else
+    {
+        if ((len & (len - 1)) == 0)
+            e = n_clog(len, 2);
+        else
+            e = n_clog(2 * len - 1, 2);
+
+        acb_dft_rad2_init(rad2, e, prec);
+        n = rad2->n;
+        gt = _acb_vec_init(n);
+        _acb_vec_set(gt, g, len);
+        acb_dft_rad2_precomp_inplace(gt, rad2, prec);
+        work.pre = NULL;
+        work.rad2 = rad2;
+    }
+
+    work.w = w;
+    work.wstride = wstride;
+    work.f = f;
+    work.fstride = fstride;
+    work.gt = gt;
+    work.len = len;
+    work.prec = prec;
+
+    if (num > 1 && flint_get_num_threads() > 1)
+    {
+        flint_parallel_do((do_func_t) _acb_dft_convol_many_worker, &work, num, -1,
+            FLINT_PARALLEL_UNIFORM);
+    }
+    else
+    {
+        for (i = 0; i < num; i++)
+            _acb_dft_convol_many_worker(i, &work);
+    }
+
+    _acb_vec_clear(gt, n);
+
+    if (work.pre != NULL)
+        acb_dft_precomp_clear(pre);
+    else
+        acb_dft_rad2_clear(rad2);
+}
@@ -0,0 +1,318 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dft.h"
+
+/*
+Fixed-point radix 2 transform. The input midpoints are converted to
+integers with a common exponent, the butterflies are done exactly on
+integers (truncating after each twiddle multiplication), and a single
+error bound for the whole transform is added at the end.
+
+Error analysis: scale so that the input components have absolute value
+at most 1 and the unit is 2^-wp. Truncating the input gives an error
+of at most sqrt(2) units (as a complex number). The twiddle factors are
+correct to within 1.5 units per component. If the entries after stage s
+have error at most eps_s, then the ones after stage s + 1 have error at
+most (2 + delta) eps_s + 3 * 2^s + sqrt(2), where delta is negligible for
+wp >= 30, since the entries are bounded by sqrt(2) 2^s. By induction,
+eps_e <= 2^e (1.5 e + 3) <= (e + 4) 2^(e+1) units.
+
+Propagated errors: each output component differs from the transform of
+the midpoints by at most the sum of all input radii.
+*/
+
+/* Converts the nz twiddle factors z to integers with wp fractional bits,
+   accurate to within 1.5 units; returns 0 if z is not accurate enough. */
+static int
+_acb_dft_fixed_roots(fmpz * zr, fmpz * zi, acb_srcptr z, slong nz, slong wp)
+{
+    slong k;
+
+    for (k = 0; k < nz; k++)
+    {
+        if (mag_cmp_2exp_si(arb_radref(acb_realref(z + k)), -wp - 1) > 0 ||
+            mag_cmp_2exp_si(arb_radref(acb_imagref(z + k)), -wp - 1) > 0)
+            return 0;
+
+        arf_get_fmpz_fixed_si(zr + k, arb_midref(acb_realref(z + k)), -wp);
+        arf_get_fmpz_fixed_si(zi + k, arb_midref(acb_imagref(z + k)), -wp);
+    }
+
+    return 1;
+}
+
+/* in-place decimation in time transform of length n on integers */
+static void
+_acb_dft_rad2_fixed_inplace(fmpz * re, fmpz * im, const fmpz * zr,
+    const fmpz * zi, slong n, slong wp)
+{
+    slong i, j, k, l, a, b;
+    fmpz_t t, u;
+
+    /* bit reversal */
+    for (i = 0, j = 0; i < n; i++)
+    {
+        if (i < j)
+        {
+            fmpz_swap(re + i, re + j);
+            fmpz_swap(im + i, im + j);
+        }
+
+        for (k = n >> 1; k > 0 && (j & k); k >>= 1)
+            j ^= k;
+        j |= k;
+    }
+
+    fmpz_init(t);
+    fmpz_init(u);
+
+    for (k = 1, l = n / 2; k < n; k <<= 1, l >>= 1)
+    {
+        for (i = 0; i < n; i += 2 * k)
+        {
+            for (j = 0; j < k; j++)
+            {
+                a = i + j;
+                b = a + k;
+
+                if (j == 0)
+                {
+                    fmpz_set(t, re + b);
+                    fmpz_set(u, im + b);
+                }
+                else
+                {
+                    fmpz_mul(t, re + b, zr + j * l);
+                    fmpz_submul(t, im + b, zi + j * l);
+                    fmpz_fdiv_q_2exp(t, t, wp);
+
+                    fmpz_mul(u, re + b, zi + j * l);
+                    fmpz_addmul(u, im + b, zr + j * l);
+                    fmpz_fdiv_q_2exp(u, u, wp);
+                }
+
+                fmpz_sub(re + b, re + a, t);
+                fmpz_add(re + a, re + a, t);
+                fmpz_sub(im + b, im + a, u);
+                fmpz_add(im + a, im + a, u);
+            }
+        }
+    }
+
+    fmpz_clear(t);
+    fmpz_clear(u);
+}
+
+/* Sets w to the DFT of v[0], v[dv], ..., v[(n-1) dv] with n = 2^e,
+   using the twiddle factors z (n/2 powers of e(-1/n)) if they are
+   accurate enough. Returns 0 (without touching w) if the input has
+   non-finite or huge entries. Allows aliasing. */
+static int
+_acb_dft_rad2_fixed(acb_ptr w, acb_srcptr v, slong dv, int e,
+    acb_srcptr z, slong prec)
+{
+    slong n, nz, k, b, E, wp;
+    fmpz *re, *im, *zr, *zi;
+    mag_t rad, err;
+    int inexact;
+
+    n = WORD(1) << e;
+    nz = n / 2;
+
+    E = WORD_MIN;
+    mag_init(rad);
+
+    for (k = 0; k < n; k++)
+    {
+        acb_srcptr x = v + k * dv;
+
+        if (!acb_is_finite(x))
+        {
+            mag_clear(rad);
+            return 0;
+        }
+
+        if (!arf_is_zero(arb_midref(acb_realref(x))))
+        {
+            b = arf_abs_bound_lt_2exp_si(arb_midref(acb_realref(x)));
+            if (b >= ARF_PREC_EXACT || b <= -ARF_PREC_EXACT)
+            {
+                mag_clear(rad);
+                return 0;
+            }
+            E = FLINT_MAX(E, b);
+        }
+
+        if (!arf_is_zero(arb_midref(acb_imagref(x))))
+        {
+            b = arf_abs_bound_lt_2exp_si(arb_midref(acb_imagref(x)));
+            if (b >= ARF_PREC_EXACT || b <= -ARF_PREC_EXACT)
+            {
+                mag_clear(rad);
+                return 0;
+            }
+            E = FLINT_MAX(E, b);
+        }
+
+        mag_add(rad, rad, arb_radref(acb_realref(x)));
+        mag_add(rad, rad, arb_radref(acb_imagref(x)));
+    }
+
+    /* all midpoints are zero */
+    if (E == WORD_MIN)
+    {
+        for (k = 0; k < n; k++)
+        {
+            acb_zero(w + k);
+            mag_set(arb_radref(acb_realref(w + k)), rad);
+            mag_set(arb_radref(acb_imagref(w + k)), rad);
+        }
+
+        mag_clear(rad);
+        return 1;
+    }
+
+    wp = prec + e + FLINT_BIT_COUNT(e + 4) + 4;
+    wp = FLINT_MAX(wp, 30);
+
+    re = _fmpz_vec_init(n);
+    im = _fmpz_vec_init(n);
+    zr = _fmpz_vec_init(nz + 1);
+    zi = _fmpz_vec_init(nz + 1);
+
+    if (z == NULL || !_acb_dft_fixed_roots(zr, zi, z, nz, wp))
+    {
+        acb_ptr zz;
+
+        zz = _acb_vec_init(nz);
+        _acb_vec_unit_roots(zz, -n, nz, wp + 16);
+        inexact = !_acb_dft_fixed_roots(zr, zi, zz, nz, wp);
+        _acb_vec_clear(zz, nz);
+
+        if (inexact)
+        {
+            _fmpz_vec_clear(re, n);
+            _fmpz_vec_clear(im, n);
+            _fmpz_vec_clear(zr, nz + 1);
+            _fmpz_vec_clear(zi, nz + 1);
+            mag_clear(rad);
+            return 0;
+        }
+    }
+
+    for (k = 0; k < n; k++)
+    {
+        arf_get_fmpz_fixed_si(re + k, arb_midref(acb_realref(v + k * dv)), E - wp);
+        arf_get_fmpz_fixed_si(im + k, arb_midref(acb_imagref(v + k * dv)), E - wp);
+    }
+
+    _acb_dft_rad2_fixed_inplace(re, im, zr, zi, n, wp);
+
+    /* one error bound for all entries */
+    mag_init(err);
+    mag_set_ui_2exp_si(err, e + 4, E - wp + e + 1);
+    mag_add(err, err, rad);
+
+    for (k = 0; k < n; k++)
+    {
+        inexact = arf_set_round_fmpz(arb_midref(acb_realref(w + k)), re + k, prec, ARB_RND);
+        arf_mul_2exp_si(arb_midref(acb_realref(w + k)), arb_midref(acb_realref(w + k)), E - wp);
+        mag_set(arb_radref(acb_realref(w + k)), err);
+        if (inexact)
+            arf_mag_add_ulp(arb_radref(acb_realref(w + k)),
+                arb_radref(acb_realref(w + k)), arb_midref(acb_realref(w + k)), prec);
+
+        inexact = arf_set_round_fmpz(arb_midref(acb_imagref(w + k)), im + k, prec, ARB_RND);
+        arf_mul_2exp_si(arb_midref(acb_imagref(w + k)), arb_midref(acb_imagref(w + k)), E - wp);
+        mag_set(arb_radref(acb_imagref(w + k)), err);
+        if (inexact)
+            arf_mag_add_ulp(arb_radref(acb_imagref(w + k)),
+                arb_radref(acb_imagref(w + k)), arb_midref(acb_imagref(w + k)), prec);
+    }
+
+    _fmpz_vec_clear(re, n);
+    _fmpz_vec_clear(im, n);
+    _fmpz_vec_clear(zr, nz + 1);
+    _fmpz_vec_clear(zi, nz + 1);
+    mag_clear(rad);
+    mag_clear(err);
+
+    return 1;
+}
+
+void
+acb_dft_rad2_precomp_fixed(acb_ptr w, acb_srcptr v, const acb_dft_rad2_t rad2, slong prec)
+{
+    if (!_acb_dft_rad2_fixed(w, v, rad2->dv, rad2->e, rad2->z, prec))
+        acb_dft_rad2_precomp(w, v, rad2, prec);
+}
+
+void
+acb_dft_rad2_fixed(acb_ptr w, acb_srcptr v, int e, slong prec)
+{
+    if (!_acb_dft_rad2_fixed(w, v, 1, e, NULL, prec))
+        acb_dft_rad2(w, v, e, prec);
+}
+
+static void
+_acb_dft_rad2_fixed_inplace_acb(acb_ptr v, const acb_dft_rad2_t rad2, slong prec)
+{
+    if (!_acb_dft_rad2_fixed(v, v, 1, rad2->e, rad2->z, prec))
+        acb_dft_rad2_precomp_inplace(v, rad2, prec);
+}
+
+void
+acb_dft_bluestein_precomp_fixed(acb_ptr w, acb_srcptr v, const acb_dft_bluestein_t t, slong prec)
+{
+    slong k, n = t->n, np = t->rad2->n, dv = t->dv;
+    acb_ptr fp;
+
+    if (n == 0)
+        return;
+
+    fp = _acb_vec_init(np);
+    _acb_vec_kronecker_mul_step(fp, t->z, v, dv, n, prec);
+
+    _acb_dft_rad2_fixed_inplace_acb(fp, t->rad2, prec);
+    _acb_vec_kronecker_mul(fp, t->g, fp, np, prec);
+
+    /* inverse transform */
+    _acb_dft_rad2_fixed_inplace_acb(fp, t->rad2, prec);
+    _acb_vec_scalar_mul_2exp_si(fp, fp, np, -t->rad2->e);
+    for (k = 1; k < np / 2; k++)
+        acb_swap(fp + k, fp + np - k);
+
+    _acb_vec_kronecker_mul(w, t->z, fp, n, prec);
+
+    _acb_vec_clear(fp, np);
+}
+
+void
+acb_dft_fixed(acb_ptr w, acb_srcptr v, slong len, slong prec)
+{
+    if (len <= 1)
+    {
+        if (len == 1)
+            acb_set(w, v);
+    }
+    else if ((len & (len - 1)) == 0)
+    {
+        acb_dft_rad2_fixed(w, v, FLINT_BIT_COUNT(len) - 1, prec);
+    }
+    else
+    {
+        acb_dft_bluestein_t t;
+        acb_dft_bluestein_init(t, len, prec);
+        acb_dft_bluestein_precomp_fixed(w, v, t, prec);
+        acb_dft_bluestein_clear(t);
+    }
+}
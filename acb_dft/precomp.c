@@ -15,6 +15,7 @@ void
 _acb_dft_precomp_init(acb_dft_pre_t pre, slong dv, acb_ptr z, slong dz, slong len, slong prec)
 {
     pre->n = len;
+    pre->prec = prec;
     if (len <= 1)
     {
         pre->type = DFT_NAIVE;
@@ -130,13 +131,24 @@ acb_dft_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec)
     }
 }
 
+/* shorter transforms are cheap to plan and would only
+   push useful plans out of the cache */
+#define ACB_DFT_CACHE_MIN_LEN 64
+
 void
 acb_dft(acb_ptr w, acb_srcptr v, slong len, slong prec)
 {
-    acb_dft_pre_t t;
-    acb_dft_precomp_init(t, len, prec);
-    acb_dft_precomp(w, v, t, prec);
-    acb_dft_precomp_clear(t);
+    if (len >= ACB_DFT_CACHE_MIN_LEN && acb_dft_cache_enabled())
+    {
+        acb_dft_precomp(w, v, acb_dft_precomp_cached(len, prec), prec);
+    }
+    else
+    {
+        acb_dft_pre_t t;
+        acb_dft_precomp_init(t, len, prec);
+        acb_dft_precomp(w, v, t, prec);
+        acb_dft_precomp_clear(t);
+    }
 }
 
 void
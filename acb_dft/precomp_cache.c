@@ -0,0 +1,141 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "pthread.h"
+#include "acb_dft.h"
+
+/*
+Each thread keeps its own small table of plans keyed by (len, prec),
+like the other precomputation caches in Arb, so no locking is needed.
+When the table is full, entries are replaced in round-robin order.
+As for the thread-local arena (arb/arena.c), a thread's table is freed
+by a pthread key destructor when the thread exits, and the table of the
+thread calling flint_cleanup is freed by a cleanup function registered
+once.
+*/
+
+static int _acb_dft_cache_enabled = 1;
+
+FLINT_TLS_PREFIX acb_dft_pre_struct _acb_dft_cache_pre[ACB_DFT_CACHE_NUM];
+FLINT_TLS_PREFIX slong _acb_dft_cache_prec[ACB_DFT_CACHE_NUM];
+FLINT_TLS_PREFIX slong _acb_dft_cache_num = 0;
+FLINT_TLS_PREFIX slong _acb_dft_cache_next = 0;
+FLINT_TLS_PREFIX int _acb_dft_cache_registered = 0;
+
+void
+acb_dft_cache_set_enabled(int enabled)
+{
+    _acb_dft_cache_enabled = enabled;
+}
+
+int
+acb_dft_cache_enabled(void)
+{
+    return _acb_dft_cache_enabled;
+}
+
+void
+acb_dft_cache_clear(void)
+{
+    slong i;
+
+    for (i = 0; i < _acb_dft_cache_num; i++)
+        acb_dft_precomp_clear(_acb_dft_cache_pre + i);
+
+    _acb_dft_cache_num = 0;
+    _acb_dft_cache_next = 0;
+}
+
+static pthread_once_t _acb_dft_cache_once = PTHREAD_ONCE_INIT;
+static pthread_key_t _acb_dft_cache_key;
+
+static void
+_acb_dft_cache_thread_exit(void * unused)
+{
+    acb_dft_cache_clear();
+    _acb_dft_cache_registered = 0;
+}
+
+static void
+_acb_dft_cache_init_once(void)
+{
+    pthread_key_create(&_acb_dft_cache_key, _acb_dft_cache_thread_exit);
+    flint_register_cleanup_function(acb_dft_cache_clear);
+}
+
+/* Takes ownership of pre, which must have been computed with
+   precision prec. Returns a pointer to the cached plan. */
+static const acb_dft_pre_struct *
+_acb_dft_cache_insert(acb_dft_pre_t pre, slong prec)
+{
+    slong i;
+
+    if (!_acb_dft_cache_registered)
+    {
+        pthread_once(&_acb_dft_cache_once, _acb_dft_cache_init_once);
+        pthread_setspecific(_acb_dft_cache_key, &_acb_dft_cache_once);
+        _acb_dft_cache_registered = 1;
+    }
+
+    if (_acb_dft_cache_num < ACB_DFT_CACHE_NUM)
+    {
+        i = _acb_dft_cache_num++;
+    }
+    else
+    {
+        i = _acb_dft_cache_next;
+        _acb_dft_cache_next = (i + 1) % ACB_DFT_CACHE_NUM;
+        acb_dft_precomp_clear(_acb_dft_cache_pre + i);
+    }
+
+    _acb_dft_cache_pre[i] = *pre;
+    _acb_dft_cache_prec[i] = prec;
+
+    return _acb_dft_cache_pre + i;
+}
+
+void
+acb_dft_cache_add(acb_dft_pre_t pre, slong prec)
+{
+    slong i;
+
+    if (pre->prec != prec)
+    {
+        flint_printf("acb_dft_cache_add: scheme computed at precision %wd, not %wd\n",
+            pre->prec, prec);
+        flint_abort();
+    }
+
+    for (i = 0; i < _acb_dft_cache_num; i++)
+    {
+        if (_acb_dft_cache_pre[i].n == pre->n && _acb_dft_cache_prec[i] == prec)
+        {
+            acb_dft_precomp_clear(pre);
+            return;
+        }
+    }
+
+    _acb_dft_cache_insert(pre, prec);
+}
+
+const acb_dft_pre_struct *
+acb_dft_precomp_cached(slong len, slong prec)
+{
+    acb_dft_pre_t pre;
+    slong i;
+
+    for (i = 0; i < _acb_dft_cache_num; i++)
+        if (_acb_dft_cache_pre[i].n == len && _acb_dft_cache_prec[i] == prec)
+            return _acb_dft_cache_pre + i;
+
+    acb_dft_precomp_init(pre, len, prec);
+    return _acb_dft_cache_insert(pre, prec);
+}
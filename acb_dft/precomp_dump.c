@@ -0,0 +1,430 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "acb_dft.h"
+
+/*
+A plan is written as a tree of whitespace-separated integers followed
+by the vectors of roots of unity it owns, in the format of arb_dump_file.
+Roots that are shared with a parent cyclic scheme are not written;
+they are linked again when loading, after checking that the indices
+used by the steps stay within the shared vector.
+*/
+
+#define ACB_DFT_DUMP_VERSION 2
+
+static int
+_dump_si(FILE * stream, slong x)
+{
+    return flint_fprintf(stream, "%wd ", x) < 0;
+}
+
+static int
+_load_si(slong * x, FILE * stream)
+{
+    return flint_fscanf(stream, "%wd", x) != 1;
+}
+
+static int
+_dump_vec(FILE * stream, acb_srcptr z, slong len)
+{
+    slong k;
+
+    if (fputc('\n', stream) == EOF)
+        return 1;
+
+    for (k = 0; k < len; k++)
+    {
+        if (arb_dump_file(stream, acb_realref(z + k)) || fputc(' ', stream) == EOF ||
+            arb_dump_file(stream, acb_imagref(z + k)) || fputc('\n', stream) == EOF)
+            return 1;
+    }
+
+    return 0;
+}
+
+static int
+_load_vec(acb_ptr z, slong len, FILE * stream)
+{
+    slong k;
+
+    for (k = 0; k < len; k++)
+    {
+        if (arb_load_file(acb_realref(z + k), stream) ||
+            arb_load_file(acb_imagref(z + k), stream))
+            return 1;
+    }
+
+    return 0;
+}
+
+static int _acb_dft_pre_dump(FILE * stream, const acb_dft_pre_t pre);
+static int _acb_dft_pre_load(acb_dft_pre_t pre, FILE * stream, acb_ptr zpar, slong zlen, slong prec);
+
+static int
+_rad2_dump(FILE * stream, const acb_dft_rad2_t t)
+{
+    return _dump_si(stream, t->e) || _dump_si(stream, t->dv)
+        || _dump_vec(stream, t->z, t->nz);
+}
+
+static int
+_rad2_load(acb_dft_rad2_t t, FILE * stream)
+{
+    slong e, dv;
+
+    if (_load_si(&e, stream) || _load_si(&dv, stream) || e < 0 || e >= FLINT_BITS - 2)
+        return 1;
+
+    t->e = e;
+    t->n = WORD(1) << e;
+    t->dv = dv;
+    t->nz = t->n >> 1;
+    t->z = _acb_vec_init(t->nz);
+
+    if (_load_vec(t->z, t->nz, stream))
+    {
+        _acb_vec_clear(t->z, t->nz);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int
+_steps_dump(FILE * stream, acb_dft_step_ptr s, slong num)
+{
+    slong i;
+
+    for (i = 0; i < num; i++)
+    {
+        if (_dump_si(stream, s[i].m) || _dump_si(stream, s[i].M) ||
+            _dump_si(stream, s[i].dv) || _dump_si(stream, s[i].dz) ||
+            _dump_si(stream, s[i].z != NULL) || _acb_dft_pre_dump(stream, s[i].pre))
+            return 1;
+    }
+
+    return 0;
+}
+
+/* the step lengths must multiply to n, with M the product of the
+   lengths of the following steps; twiddles z + dz * i * j with i < m,
+   j < M must lie in z */
+static int
+_step_valid(const acb_dft_step_struct * s, slong rem, int has_z, slong zlen)
+{
+    if (s->m < 1 || s->m > rem || rem % s->m != 0 || s->M != rem / s->m)
+        return 0;
+
+    if (s->dv < 1 || s->dz < 0)
+        return 0;
+
+    if (has_z && s->dz != 0 && s->m * s->M > zlen / s->dz)
+        return 0;
+
+    return 1;
+}
+
+/* z is the root vector of the enclosing cyclic scheme (or NULL),
+   of length zlen */
+static int
+_steps_load(acb_dft_step_ptr s, slong num, slong n, FILE * stream,
+    acb_ptr z, slong zlen, slong prec)
+{
+    slong i, j, has_z, rem;
+
+    rem = n;
+
+    for (i = 0; i < num; i++)
+    {
+        if (_load_si(&s[i].m, stream) || _load_si(&s[i].M, stream) ||
+            _load_si(&s[i].dv, stream) || _load_si(&s[i].dz, stream) ||
+            _load_si(&has_z, stream) || (has_z && z == NULL) ||
+            !_step_valid(s + i, rem, has_z, zlen) ||
+            _acb_dft_pre_load(s[i].pre, stream, z, zlen, prec))
+        {
+            for (j = 0; j < i; j++)
+                acb_dft_precomp_clear(s[j].pre);
+            return 1;
+        }
+
+        if (s[i].pre->n != s[i].m)
+        {
+            for (j = 0; j <= i; j++)
+                acb_dft_precomp_clear(s[j].pre);
+            return 1;
+        }
+
+        s[i].z = has_z ? z : NULL;
+        rem = s[i].M;
+    }
+
+    if (rem != 1)
+    {
+        for (j = 0; j < num; j++)
+            acb_dft_precomp_clear(s[j].pre);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int
+_acb_dft_pre_dump(FILE * stream, const acb_dft_pre_t pre)
+{
+    if (fputc('\n', stream) == EOF || _dump_si(stream, pre->type) || _dump_si(stream, pre->n))
+        return 1;
+
+    switch (pre->type)
+    {
+        case DFT_NAIVE:
+            return _dump_si(stream, pre->t.naive->dv)
+                || _dump_si(stream, pre->t.naive->zclear)
+                || _dump_si(stream, pre->t.naive->dz)
+                || (pre->t.naive->zclear && _dump_vec(stream, pre->t.naive->z, pre->n));
+        case DFT_CYC:
+            return _dump_si(stream, pre->t.cyc->zclear)
+                || _dump_si(stream, pre->t.cyc->num)
+                || (pre->t.cyc->zclear && _dump_vec(stream, pre->t.cyc->z, pre->n))
+                || _steps_dump(stream, pre->t.cyc->cyc, pre->t.cyc->num);
+        case DFT_PROD:
+            return _dump_si(stream, pre->t.prod->num)
+                || _steps_dump(stream, pre->t.prod->cyc, pre->t.prod->num);
+        case DFT_CRT:
+            return _dump_si(stream, pre->t.crt->dv)
+                || _dump_si(stream, pre->t.crt->c->num)
+                || _steps_dump(stream, pre->t.crt->cyc, pre->t.crt->c->num);
+        case DFT_RAD2:
+            return _rad2_dump(stream, pre->t.rad2);
+        case DFT_CONV:
+            return _dump_si(stream, pre->t.bluestein->dv)
+                || (pre->n != 0 && (_rad2_dump(stream, pre->t.bluestein->rad2)
+                    || _dump_vec(stream, pre->t.bluestein->z, pre->n)
+                    || _dump_vec(stream, pre->t.bluestein->g, pre->t.bluestein->rad2->n)));
+        default:
+            return 1;
+    }
+}
+
+static int
+_acb_dft_pre_load(acb_dft_pre_t pre, FILE * stream, acb_ptr zpar, slong zlen, slong prec)
+{
+    slong type, n, a, b, c;
+
+    if (_load_si(&type, stream) || _load_si(&n, stream) || n < 0)
+        return 1;
+
+    pre->type = type;
+    pre->n = n;
+    pre->prec = prec;
+
+    switch (type)
+    {
+        case DFT_NAIVE:
+        {
+            acb_dft_naive_struct * t = pre->t.naive;
+
+            if (_load_si(&a, stream) || _load_si(&b, stream) || _load_si(&c, stream))
+                return 1;
+
+            t->n = n;
+            t->dv = a;
+            t->zclear = (b != 0);
+            t->dz = c;
+
+            if (t->zclear)
+            {
+                t->z = _acb_vec_init(n);
+                if (_load_vec(t->z, n, stream))
+                {
+                    _acb_vec_clear(t->z, n);
+                    return 1;
+                }
+            }
+            else
+            {
+                /* indices dz * (i * j % n) for i, j < n */
+                if (zpar == NULL || c < 0 || (n > 1 && c > (zlen - 1) / (n - 1)))
+                    return 1;
+                t->z = zpar;
+            }
+
+            return 0;
+        }
+
+        case DFT_CYC:
+        {
+            acb_dft_cyc_struct * t = pre->t.cyc;
+
+            if (_load_si(&a, stream) || _load_si(&b, stream) || b < 0)
+                return 1;
+
+            t->n = n;
+            t->zclear = (a != 0);
+            t->num = b;
+
+            if (t->zclear)
+            {
+                t->z = _acb_vec_init(n);
+                if (_load_vec(t->z, n, stream))
+                {
+                    _acb_vec_clear(t->z, n);
+                    return 1;
+                }
+            }
+            else
+            {
+                if (zpar == NULL)
+                    return 1;
+                t->z = zpar;
+            }
+
+            t->cyc = flint_malloc(t->num * sizeof(acb_dft_step_struct));
+
+            if (_steps_load(t->cyc, t->num, n, stream, t->z, t->zclear ? n : zlen, prec))
+            {
+                flint_free(t->cyc);
+                if (t->zclear)
+                    _acb_vec_clear(t->z, n);
+                return 1;
+            }
+
+            return 0;
+        }
+
+        case DFT_PROD:
+        {
+            acb_dft_prod_struct * t = pre->t.prod;
+
+            if (_load_si(&a, stream) || a < 0)
+                return 1;
+
+            t->n = n;
+            t->num = a;
+            t->cyc = flint_malloc(t->num * sizeof(acb_dft_step_struct));
+
+            if (_steps_load(t->cyc, t->num, n, stream, NULL, 0, prec))
+            {
+                flint_free(t->cyc);
+                return 1;
+            }
+
+            return 0;
+        }
+
+        case DFT_CRT:
+        {
+            acb_dft_crt_struct * t = pre->t.crt;
+
+            if (_load_si(&a, stream) || _load_si(&b, stream))
+                return 1;
+
+            t->n = n;
+            t->dv = a;
+            crt_init(t->c, n);
+
+            if (t->c->num != b)
+                return 1;
+
+            t->cyc = flint_malloc(t->c->num * sizeof(acb_dft_step_struct));
+
+            if (_steps_load(t->cyc, t->c->num, n, stream, NULL, 0, prec))
+            {
+                flint_free(t->cyc);
+                return 1;
+            }
+
+            return 0;
+        }
+
+        case DFT_RAD2:
+        {
+            if (_rad2_load(pre->t.rad2, stream))
+                return 1;
+
+            if (pre->t.rad2->n != n)
+            {
+                acb_dft_rad2_clear(pre->t.rad2);
+                return 1;
+            }
+
+            return 0;
+        }
+
+        case DFT_CONV:
+        {
+            acb_dft_bluestein_struct * t = pre->t.bluestein;
+
+            if (_load_si(&a, stream) || a < 1)
+                return 1;
+
+            t->n = n;
+            t->dv = a;
+
+            if (n == 0)
+                return 0;
+
+            if (_rad2_load(t->rad2, stream))
+                return 1;
+
+            /* the convolution has length 2n - 1 */
+            if (n > WORD_MAX / 4 || t->rad2->n < 2 * n - 1)
+            {
+                acb_dft_rad2_clear(t->rad2);
+                return 1;
+            }
+
+            t->z = _acb_vec_init(n);
+            t->g = _acb_vec_init(t->rad2->n);
+
+            if (_load_vec(t->z, n, stream) || _load_vec(t->g, t->rad2->n, stream))
+            {
+                acb_dft_bluestein_clear(t);
+                return 1;
+            }
+
+            return 0;
+        }
+
+        default:
+            return 1;
+    }
+}
+
+int
+acb_dft_precomp_dump_file(FILE * stream, const acb_dft_pre_t pre)
+{
+    if (flint_fprintf(stream, "acb_dft %d ", ACB_DFT_DUMP_VERSION) < 0 ||
+        _dump_si(stream, pre->prec))
+        return 1;
+
+    if (_acb_dft_pre_dump(stream, pre))
+        return 1;
+
+    return fputc('\n', stream) == EOF;
+}
+
+int
+acb_dft_precomp_load_file(acb_dft_pre_t pre, FILE * stream)
+{
+    char tag[8];
+    int version;
+    slong prec;
+
+    if (fscanf(stream, "%7s %d", tag, &version) != 2 ||
+        strcmp(tag, "acb_dft") != 0 || version != ACB_DFT_DUMP_VERSION ||
+        _load_si(&prec, stream) || prec < 2)
+        return 1;
+
+    return _acb_dft_pre_load(pre, stream, NULL, 0, prec);
+}
@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "acb_dft.h"
+
+typedef struct
+{
+    acb_ptr w;
+    slong wstride;
+    acb_srcptr v;
+    slong vstride;
+    const acb_dft_pre_struct * pre;
+    int inverse;
+    slong prec;
+}
+_acb_dft_many_work_t;
+
+static void
+_acb_dft_many_worker(slong i, _acb_dft_many_work_t * work)
+{
+    if (work->inverse)
+        acb_dft_inverse_precomp(work->w + i * work->wstride,
+            work->v + i * work->vstride, work->pre, work->prec);
+    else
+        acb_dft_precomp(work->w + i * work->wstride,
+            work->v + i * work->vstride, work->pre, work->prec);
+}
+
+static void
+_acb_dft_precomp_many(acb_ptr w, slong wstride, acb_srcptr v, slong vstride,
+    slong num, const acb_dft_pre_t pre, int inverse, slong prec)
+{
+    _acb_dft_many_work_t work;
+    slong i;
+
+    work.w = w;
+    work.wstride = wstride;
+    work.v = v;
+    work.vstride = vstride;
+    work.pre = pre;
+    work.inverse = inverse;
+    work.prec = prec;
+
+    /* one vector per task: the scheme is shared read-only by all threads */
+    if (num > 1 && flint_get_num_threads() > 1)
+    {
+        flint_parallel_do((do_func_t) _acb_dft_many_worker, &work, num, -1,
+            FLINT_PARALLEL_UNIFORM);
+    }
+    else
+    {
+        for (i = 0; i < num; i++)
+            _acb_dft_many_worker(i, &work);
+    }
+}
+
+void
+acb_dft_precomp_many(acb_ptr w, slong wstride, acb_srcptr v, slong vstride,
+    slong num, const acb_dft_pre_t pre, slong prec)
+{
+    _acb_dft_precomp_many(w, wstride, v, vstride, num, pre, 0, prec);
+}
+
+void
+acb_dft_inverse_precomp_many(acb_ptr w, slong wstride, acb_srcptr v, slong vstride,
+    slong num, const acb_dft_pre_t pre, slong prec)
+{
+    _acb_dft_precomp_many(w, wstride, v, vstride, num, pre, 1, prec);
+}
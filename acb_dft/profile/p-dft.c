@@ -26,19 +26,21 @@ int main(int argc, char *argv[])
     flint_rand_t state;
     slong r, nr;
 
-    int l, nf = 5;
-    do_f func[5] = {
+    int l, nf = 6;
+    do_f func[6] = {
         acb_dft_naive,
         acb_dft_crt,
         acb_dft_cyc,
         acb_dft_bluestein,
+        acb_dft_fixed,
         acb_dft
     };
-    char * name[6] = {
+    char * name[7] = {
         "naive",
         "crt",
         "cyc",
         "bluestein",
+        "fixed",
         "default",
         "precomp"
     };
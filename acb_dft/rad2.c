@@ -53,6 +53,97 @@ _acb_dft_rad2_init(acb_dft_rad2_t t, slong dv, int e, slong prec)
     _acb_vec_unit_roots(t->z, -t->n, t->nz, prec);
 }
 
+/* radix-2 butterflies with trivial twiddles on the pairs
+   (2b, 2b + 1) for b0 <= b < b1 */
+void
+_acb_dft_rad2_stage_first(acb_ptr v, slong b0, slong b1, slong prec)
+{
+    acb_ptr p;
+    acb_t tmp;
+
+    acb_init(tmp);
+
+    for (p = v + 2 * b0; p < v + 2 * b1; p += 2)
+    {
+        acb_set(tmp, p + 1);
+        acb_sub(p + 1, p + 0, tmp, prec);
+        acb_add(p + 0, p + 0, tmp, prec);
+    }
+
+    acb_clear(tmp);
+}
+
+/*
+Butterflies b0 <= b < b1 of one radix-4 stage merging blocks of size k
+into blocks of size 4k; butterfly b acts on the block b / k at offset
+j = b % k. After the previous stages, the four consecutive subblocks of
+size k contain the DFTs of the entries with residues 0, 2, 1, 3 mod 4
+(bit-reversed order). With w = e(-j/4k), this needs three
+multiplications by w^j, w^2j, w^3j per four outputs instead of four
+for two radix-2 stages. The table z contains the nz = n/2 first
+powers of e(-1/n); w^m for m >= nz is obtained as -z[m - nz].
+The butterflies of a stage are independent, so that any partition
+of the range gives the same result.
+*/
+void
+_acb_dft_rad4_stage(acb_ptr v, slong n, slong k, acb_srcptr z, slong nz,
+    slong b0, slong b1, slong prec)
+{
+    slong i, j, l, m;
+    acb_ptr a, b, c, d, t;
+    acb_srcptr t1, t2, t3;
+
+    l = n / (4 * k);
+    t = _acb_vec_init(7);
+
+    for (i = b0; i < b1; i++)
+    {
+        j = i % k;
+        a = v + 4 * k * (i / k) + j;
+        b = a + k;
+        c = b + k;
+        d = c + k;
+
+        if (j == 0)
+        {
+            t1 = c;
+            t2 = b;
+            t3 = d;
+        }
+        else
+        {
+            acb_mul(t + 4, c, z + j * l, prec);
+            acb_mul(t + 5, b, z + 2 * j * l, prec);
+            m = 3 * j * l;
+            if (m < nz)
+            {
+                acb_mul(t + 6, d, z + m, prec);
+            }
+            else
+            {
+                acb_mul(t + 6, d, z + m - nz, prec);
+                acb_neg(t + 6, t + 6);
+            }
+            t1 = t + 4;
+            t2 = t + 5;
+            t3 = t + 6;
+        }
+
+        acb_add(t + 0, a, t2, prec);
+        acb_sub(t + 1, a, t2, prec);
+        acb_add(t + 2, t1, t3, prec);
+        acb_sub(t + 3, t1, t3, prec);
+        acb_div_onei(t + 3, t + 3);
+
+        acb_add(a, t + 0, t + 2, prec);
+        acb_sub(c, t + 0, t + 2, prec);
+        acb_add(b, t + 1, t + 3, prec);
+        acb_sub(d, t + 1, t + 3, prec);
+    }
+
+    _acb_vec_clear(t, 7);
+}
+
 /* remark: can use same rad2 with smaller power of 2 */
 void
 acb_dft_rad2_precomp_inplace(acb_ptr v, const acb_dft_rad2_t rad2, slong prec)
@@ -63,24 +154,21 @@ acb_dft_rad2_precomp_inplace(acb_ptr v, const acb_dft_rad2_t rad2, slong prec)
     }
     else
     {
-        slong j, k, l;
-        slong n = rad2->n, nz = rad2->nz;
-        acb_ptr p, vend = v + n, w = rad2->z;
-        acb_t tmp;
-        acb_init(tmp);
+        slong k, n = rad2->n;
 
         acb_dft_rad2_reorder(v, n);
 
-        for (k = 1, l = nz; k < n; k <<= 1, l >>= 1)
-            for (p = v; p < vend; p += k)
-                for (j = 0; j < nz; j += l, p++)
-                {
-                    acb_mul(tmp, p + k, w + j, prec);
-                    acb_sub(p + k, p + 0, tmp, prec);
-                    acb_add(p + 0, p + 0, tmp, prec);
-                }
+        k = 1;
+
+        /* for odd e, start with a radix-2 stage (the twiddles are 1) */
+        if (rad2->e % 2 == 1)
+        {
+            _acb_dft_rad2_stage_first(v, 0, n / 2, prec);
+            k = 2;
+        }
 
-        acb_clear(tmp);
+        for ( ; 4 * k <= n; k *= 4)
+            _acb_dft_rad4_stage(v, n, k, rad2->z, rad2->nz, 0, n / 4, prec);
     }
 }
 
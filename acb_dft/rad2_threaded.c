@@ -10,109 +10,101 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_dft.h"
-#include "pthread.h"
 
 void acb_dft_rad2_reorder(acb_ptr v, slong n);
+void _acb_dft_rad2_stage_first(acb_ptr v, slong b0, slong b1, slong prec);
+void _acb_dft_rad4_stage(acb_ptr v, slong n, slong k, acb_srcptr z, slong nz,
+    slong b0, slong b1, slong prec);
+
+/* Only go parallel when each stage has at least this much work
+   (number of butterflies weighted by the number of limbs). */
+#define RAD2_THREADED_MIN_WORK 1024
+
+/*
+The stages are the same as in acb_dft_rad2_precomp_inplace (a radix-2
+stage when e is odd, followed by radix-4 stages); the butterflies of
+each stage are split into contiguous ranges, one per thread. Since the
+butterflies of a stage are independent, the result does not depend on
+the number of threads.
+*/
 
 typedef struct
 {
     acb_ptr v;
-    acb_ptr vend;
-    slong k;
-    slong l;
-    slong jstart;
-    slong jend;
-    acb_srcptr w;
+    slong n;
+    slong k;        /* 0 for the leading radix-2 stage */
+    acb_srcptr z;
+    slong nz;
+    slong nb;       /* number of butterflies in the stage */
+    slong t;        /* number of ranges */
     slong prec;
 }
 acb_dft_rad2_arg_t;
 
-void *
-_acb_dft_rad2_thread(void * arg_ptr)
+static void
+_acb_dft_rad2_worker(slong i, acb_dft_rad2_arg_t * arg)
 {
-    acb_dft_rad2_arg_t arg = *((acb_dft_rad2_arg_t *) arg_ptr);
-    slong j, rstart, pstep;
-    acb_ptr p, r;
-    acb_t tmp;
+    slong b0, b1;
 
-    acb_init(tmp);
-    rstart = arg.jstart / arg.l;
-    pstep = 2 * arg.k;
+    b0 = (arg->nb * i) / arg->t;
+    b1 = (arg->nb * (i + 1)) / arg->t;
 
-    for (p = arg.v; p < arg.vend; p += pstep)
-    {
-        for (r = p + rstart, j = arg.jstart; j < arg.jend; j += arg.l, r++)
-        {
-            acb_mul(tmp, r + arg.k, arg.w + j, arg.prec);
-            acb_sub(r + arg.k, r + 0, tmp, arg.prec);
-            acb_add(r + 0, r + 0, tmp, arg.prec);
-        }
-    }
+    if (arg->k == 0)
+        _acb_dft_rad2_stage_first(arg->v, b0, b1, arg->prec);
+    else
+        _acb_dft_rad4_stage(arg->v, arg->n, arg->k, arg->z, arg->nz,
+            b0, b1, arg->prec);
+}
 
-    acb_clear(tmp);
-    flint_cleanup();
-    return NULL;
+static void
+_acb_dft_rad2_run_stage(acb_dft_rad2_arg_t * arg)
+{
+    if (arg->t == 1)
+        _acb_dft_rad2_worker(0, arg);
+    else
+        flint_parallel_do((do_func_t) _acb_dft_rad2_worker, arg, arg->t, -1,
+            FLINT_PARALLEL_UNIFORM);
 }
 
 void
 acb_dft_rad2_precomp_inplace_threaded(acb_ptr v, const acb_dft_rad2_t rad2, slong prec)
 {
-    slong num_threads;
-    pthread_t * threads;
-    acb_dft_rad2_arg_t * args;
-
-    slong t, logt, logk, logl;
+    acb_dft_rad2_arg_t arg;
     slong n = rad2->n;
-    slong nz = rad2->nz; /* always n/2 ? */
-    slong logn = rad2->e;
+    slong k, num_threads;
 
-    num_threads = FLINT_MIN(flint_get_num_threads(), nz);
-    for (logt = 0; WORD(1) << (logt + 1) <= num_threads; logt++);
-    t = WORD(1) << logt;
+    num_threads = FLINT_MIN(flint_get_num_threads(), FLINT_MAX(n / 4, 1));
 
-    threads = flint_malloc(sizeof(pthread_t) * t);
-    args = flint_malloc(sizeof(acb_dft_rad2_arg_t) * t);
+    if ((double) rad2->nz * (1 + prec / FLINT_BITS) < RAD2_THREADED_MIN_WORK)
+        num_threads = 1;
 
     acb_dft_rad2_reorder(v, n);
 
-    for (logk = 0, logl = logn - 1; logk < logn; logk += 1, logl -= 1)
+    arg.v = v;
+    arg.n = n;
+    arg.z = rad2->z;
+    arg.nz = rad2->nz;
+    arg.t = num_threads;
+    arg.prec = prec;
+
+    k = 1;
+
+    if (rad2->e % 2 == 1)
     {
-        slong i, j, p;
-        slong logpstep = logk + 1 + FLINT_MAX(0, logl - logt);
-        slong logjstep = logl + FLINT_MIN(logk, logn - 1 - logt);
-        slong pstep = WORD(1) << logpstep;
-        slong jstep = WORD(1) << logjstep;
-        i = 0;
-        for (p = 0; p < n; p += pstep)
-        {
-            for (j = 0; j < nz ; j += jstep)
-            {
-                args[i].v = v + p;
-                args[i].vend = v + p + pstep;
-                args[i].jstart = j;
-                args[i].jend = j + jstep;
-                args[i].k = WORD(1) << logk;
-                args[i].l = WORD(1) << logl;
-                args[i].w = rad2->z;
-                args[i].prec = prec;
-                pthread_create(&threads[i], NULL, _acb_dft_rad2_thread, &args[i]);
-                i++;
-            }
-        }
-        if (i != t)
-        {
-            flint_printf("threaded dft error: unequal i=%wd t=%wd\n", i, t);
-            flint_abort();
-        }
-        for (i = 0; i < t; i++)
-        {
-            pthread_join(threads[i], NULL);
-        }
+        arg.k = 0;
+        arg.nb = n / 2;
+        _acb_dft_rad2_run_stage(&arg);
+        k = 2;
     }
 
-    flint_free(threads);
-    flint_free(args);
+    for ( ; 4 * k <= n; k *= 4)
+    {
+        arg.k = k;
+        arg.nb = n / 4;
+        _acb_dft_rad2_run_stage(&arg);
+    }
 }
 
 void
@@ -9,10 +9,50 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_dft.h"
 
 #define REORDER 0
 
+/* Only distribute the partial transforms over threads when the
+   step has at least this many entries. */
+#define STEP_THREADED_MIN_LEN 256
+
+typedef struct
+{
+    acb_ptr w;
+    acb_srcptr v;
+    acb_ptr t;
+    acb_dft_step_ptr cyc;
+    slong num;
+    slong prec;
+}
+_acb_dft_step_work_t;
+
+/* i-th DFT of size M, followed by its twiddle factors */
+static void
+_acb_dft_step_inner_worker(slong i, _acb_dft_step_work_t * s)
+{
+    acb_dft_step_struct c = s->cyc[0];
+    acb_ptr wi = s->w + i * c.M;
+    slong j;
+
+    acb_dft_step(wi, s->v + i * c.dv, s->cyc + 1, s->num - 1, s->prec);
+
+    if (c.z != NULL && i != 0)
+        for (j = 1; j < c.M; j++)
+            acb_mul(wi + j, wi + j, c.z + c.dz * i * j, s->prec);
+}
+
+/* j-th DFT of size m */
+static void
+_acb_dft_step_outer_worker(slong j, _acb_dft_step_work_t * s)
+{
+    acb_dft_step_struct c = s->cyc[0];
+
+    acb_dft_precomp(s->t + c.m * j, s->w + j, c.pre, s->prec);
+}
+
 void
 acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong prec)
 {
@@ -43,36 +83,56 @@ acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong pre
             v = t;
         }
 
-        /* m DFT of size M */
-        for (i = 0; i < m; i++)
-            acb_dft_step(w + i * M, v + i * dv, cyc + 1, num - 1, prec);
-
-        /* twiddle if non trivial product */
-        if (c.z != NULL)
+        if (m * M >= STEP_THREADED_MIN_LEN && flint_get_num_threads() > 1)
         {
-            acb_ptr wi;
-            for (wi = w + M, i = 1; i < m; i++, wi += M)
-                for (j = 1; j < M; j++)
-                {
-                    if (DFT_VERB)
-                        flint_printf("z[%wu*%wu]",dz,i*j);
-                    acb_mul(wi + j, wi + j, z + dz * i * j, prec);
-                }
-            if (DFT_VERB)
-                flint_printf("\n");
+            _acb_dft_step_work_t work;
+
+            work.w = w;
+            work.v = v;
+            work.t = t;
+            work.cyc = cyc;
+            work.num = num;
+            work.prec = prec;
+
+            /* m DFT of size M, and twiddle */
+            flint_parallel_do((do_func_t) _acb_dft_step_inner_worker, &work, m, -1, FLINT_PARALLEL_UNIFORM);
+
+            /* M DFT of size m */
+            flint_parallel_do((do_func_t) _acb_dft_step_outer_worker, &work, M, -1, FLINT_PARALLEL_UNIFORM);
         }
+        else
+        {
+            /* m DFT of size M */
+            for (i = 0; i < m; i++)
+                acb_dft_step(w + i * M, v + i * dv, cyc + 1, num - 1, prec);
+
+            /* twiddle if non trivial product */
+            if (c.z != NULL)
+            {
+                acb_ptr wi;
+                for (wi = w + M, i = 1; i < m; i++, wi += M)
+                    for (j = 1; j < M; j++)
+                    {
+                        if (DFT_VERB)
+                            flint_printf("z[%wu*%wu]",dz,i*j);
+                        acb_mul(wi + j, wi + j, z + dz * i * j, prec);
+                    }
+                if (DFT_VERB)
+                    flint_printf("\n");
+            }
 
 #if REORDER
-        /* reorder w to avoid dv shifts in next DFT */
-        w2 = flint_malloc(m * M * sizeof(acb_struct)); 
-        for (j = 0; j < M; j++)
-            for (i = 0; i < m; i++)
-                w2[j + M * i] = w[i + m * j];
+            /* reorder w to avoid dv shifts in next DFT */
+            w2 = flint_malloc(m * M * sizeof(acb_struct));
+            for (j = 0; j < M; j++)
+                for (i = 0; i < m; i++)
+                    w2[j + M * i] = w[i + m * j];
 #endif
 
-        /* M DFT of size m */
-        for (j = 0; j < M; j++)
-            acb_dft_precomp(t + m * j, w + j, c.pre, prec);
+            /* M DFT of size m */
+            for (j = 0; j < M; j++)
+                acb_dft_precomp(t + m * j, w + j, c.pre, prec);
+        }
 
         /* reorder */
         for (i = 0; i < m; i++)
@@ -115,6 +115,42 @@ int main()
         _acb_vec_clear(z2, len);
     }
 
+    /* batched convolutions */
+    for (k = 0; k < 10; k++)
+    {
+        slong i, j, len, num, stride;
+        acb_ptr z1, z2, x, y;
+
+        len = 1 + n_randint(state, 400);
+        num = 1 + n_randint(state, 10);
+        stride = len + n_randint(state, 3);
+
+        z1 = _acb_vec_init(len);
+        z2 = _acb_vec_init(num * stride);
+        x = _acb_vec_init(num * stride);
+        y = _acb_vec_init(len);
+
+        for (i = 0; i < num * stride; i++)
+            acb_set_si(x + i, n_randint(state, 4 * len));
+        for (i = 0; i < len; i++)
+            acb_set_si(y + i, n_randint(state, 4 * len));
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        acb_dft_convol_many(z2, stride, x, stride, y, len, num, prec);
+
+        for (j = 0; j < num; j++)
+        {
+            acb_dft_convol_naive(z1, x + j * stride, y, len, prec);
+            check_vec_eq_prec(z1, z2 + j * stride, len, prec, digits, len, "naive", "many");
+        }
+
+        _acb_vec_clear(x, num * stride);
+        _acb_vec_clear(y, len);
+        _acb_vec_clear(z1, len);
+        _acb_vec_clear(z2, num * stride);
+    }
+
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
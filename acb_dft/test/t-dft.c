@@ -59,9 +59,9 @@ int main()
     slong nr = 5;
     flint_rand_t state;
 
-    slong f, nf = 5;
-    do_f func[5] = { acb_dft_naive, acb_dft_cyc, acb_dft_crt, acb_dft_bluestein, acb_dft };
-    char * name[5] = { "naive", "cyc", "crt", "bluestein", "default" };
+    slong f, nf = 6;
+    do_f func[6] = { acb_dft_naive, acb_dft_cyc, acb_dft_crt, acb_dft_bluestein, acb_dft_fixed, acb_dft };
+    char * name[6] = { "naive", "cyc", "crt", "bluestein", "fixed", "default" };
 
     flint_printf("dft....");
     fflush(stdout);
@@ -141,6 +141,13 @@ int main()
             acb_set_si_si(v + j, j, j + 2);
 
         acb_dft_cyc(w1, v, n, prec);
+        acb_dft_rad2_fixed(w2, v, k, prec);
+
+        check_vec_eq_prec(w1, w2, n, prec, digits, n, "rad2", "cyc", "rad2_fixed");
+
+        for (j = 0; j < n; j++)
+            acb_set_si_si(v + j, j, j + 2);
+
         acb_dft_rad2_inplace(w2, k, prec);
 
         check_vec_eq_prec(w1, w2, n, prec, digits, n, "rad2", "cyc", "rad2");
@@ -173,6 +180,118 @@ int main()
 
     }
 
+    /* multi-threaded products and bluestein */
+    for (k = 0; k < 6; k++)
+    {
+        slong lens[6] = { 256, 525, 1021, 1225, 2048, 2310 };
+        slong n = lens[k], j;
+        acb_ptr v, w1, w2;
+
+        v = _acb_vec_init(n);
+        w1 = _acb_vec_init(n);
+        w2 = _acb_vec_init(n);
+
+        for (j = 0; j < n; j++)
+            acb_set_si_si(v + j, j, 3 - j);
+
+        flint_set_num_threads(1);
+        acb_dft_crt(w1, v, n, prec);
+
+        for (f = 1; f < nf; f++)
+        {
+            flint_set_num_threads(2 + n_randint(state, 3));
+            func[f](w2, v, n, prec);
+            check_vec_eq_prec(w1, w2, n, prec, digits, n, "threaded", "crt", name[f]);
+        }
+
+        _acb_vec_clear(v, n);
+        _acb_vec_clear(w1, n);
+        _acb_vec_clear(w2, n);
+    }
+
+    /* batched transforms */
+    for (k = 0; k < 8; k++)
+    {
+        slong n = 1 + n_randint(state, 300), num = 1 + n_randint(state, 20);
+        slong stride = n + n_randint(state, 3), j, i;
+        acb_dft_pre_t pre;
+        acb_ptr v, w1, w2;
+
+        v = _acb_vec_init(num * stride);
+        w1 = _acb_vec_init(n);
+        w2 = _acb_vec_init(num * stride);
+
+        for (j = 0; j < num * stride; j++)
+            acb_set_si_si(v + j, n_randint(state, 100), j % 7);
+
+        acb_dft_precomp_init(pre, n, prec);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        acb_dft_precomp_many(w2, stride, v, stride, num, pre, prec);
+
+        for (i = 0; i < num; i++)
+        {
+            acb_dft_precomp(w1, v + i * stride, pre, prec);
+            check_vec_eq_prec(w1, w2 + i * stride, n, prec, digits, n, "many", "precomp", "precomp_many");
+        }
+
+        /* in place, then back */
+        acb_dft_inverse_precomp_many(w2, stride, w2, stride, num, pre, prec);
+
+        for (i = 0; i < num; i++)
+            check_vec_eq_prec(v + i * stride, w2 + i * stride, n, prec, digits, n, "many", "original", "inverse_many");
+
+        acb_dft_precomp_clear(pre);
+        _acb_vec_clear(v, num * stride);
+        _acb_vec_clear(w1, n);
+        _acb_vec_clear(w2, num * stride);
+    }
+
+    /* radix 2 (e > 9) and bluestein give identical results
+       for any number of threads */
+    for (k = 0; k < 4; k++)
+    {
+        slong lens[4] = { 1024, 2048, 4096, 1500 };
+        slong n = lens[k], j;
+        acb_ptr v, w1, w2;
+
+        v = _acb_vec_init(n);
+        w1 = _acb_vec_init(n);
+        w2 = _acb_vec_init(n);
+
+        for (j = 0; j < n; j++)
+            acb_set_si_si(v + j, j, 3 - j);
+
+        flint_set_num_threads(1);
+        if (k < 3)
+            acb_dft_rad2(w1, v, 10 + k, prec);
+        else
+            acb_dft_bluestein(w1, v, n, prec);
+
+        flint_set_num_threads(2 + n_randint(state, 3));
+        if (k < 3)
+            acb_dft_rad2(w2, v, 10 + k, prec);
+        else
+            acb_dft_bluestein(w2, v, n, prec);
+
+        for (j = 0; j < n; j++)
+        {
+            if (!acb_equal(w1 + j, w2 + j))
+            {
+                flint_printf("FAIL (thread count)\n\n");
+                flint_printf("n = %wd, j = %wd\n\n", n, j);
+                acb_printd(w1 + j, digits); flint_printf("\n");
+                acb_printd(w2 + j, digits); flint_printf("\n");
+                abort();
+            }
+        }
+
+        _acb_vec_clear(v, n);
+        _acb_vec_clear(w1, n);
+        _acb_vec_clear(w2, n);
+    }
+
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
@@ -0,0 +1,184 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "acb_dft.h"
+
+static int
+_acb_vec_equal_check(acb_srcptr x, acb_srcptr y, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        if (!acb_equal(x + i, y + i))
+            return 0;
+
+    return 1;
+}
+
+int main()
+{
+    slong k, iter;
+    slong lens[12] = { 0, 1, 2, 7, 64, 100, 101, 125, 256, 360, 1009, 1024 };
+    flint_rand_t state;
+
+    flint_printf("precomp_dump....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+/* assume tmpfile() is broken on windows */
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+
+    for (iter = 0; iter < 24; iter++)
+    {
+        acb_dft_pre_t pre1, pre2;
+        acb_ptr v, w1, w2;
+        slong len, prec;
+        FILE * tmp;
+
+        len = (iter < 12) ? lens[iter] : 1 + n_randint(state, 600);
+        prec = 2 + n_randint(state, 200);
+
+        v = _acb_vec_init(len);
+        w1 = _acb_vec_init(len);
+        w2 = _acb_vec_init(len);
+
+        for (k = 0; k < len; k++)
+            acb_randtest(v + k, state, prec, 4);
+
+        acb_dft_precomp_init(pre1, len, prec);
+
+        tmp = tmpfile();
+        if (tmp == NULL)
+        {
+            flint_printf("FAIL (creating temporary file)  iter = %wd\n\n", iter);
+            flint_abort();
+        }
+
+        if (acb_dft_precomp_dump_file(tmp, pre1))
+        {
+            flint_printf("FAIL (dump)  len = %wd\n\n", len);
+            flint_abort();
+        }
+
+        fflush(tmp);
+        rewind(tmp);
+
+        if (acb_dft_precomp_load_file(pre2, tmp))
+        {
+            flint_printf("FAIL (load)  len = %wd\n\n", len);
+            flint_abort();
+        }
+
+        fclose(tmp);
+
+        if (pre2->prec != prec)
+        {
+            flint_printf("FAIL (prec)  len = %wd, prec = %wd, %wd\n\n", len, prec, pre2->prec);
+            flint_abort();
+        }
+
+        acb_dft_precomp(w1, v, pre1, prec);
+        acb_dft_precomp(w2, v, pre2, prec);
+
+        if (!_acb_vec_equal_check(w1, w2, len))
+        {
+            flint_printf("FAIL (roundtrip)  len = %wd, prec = %wd\n\n", len, prec);
+            flint_abort();
+        }
+
+        /* the cached transform is the same as the uncached one */
+        acb_dft_cache_add(pre2, prec);
+
+        acb_dft_cache_set_enabled(n_randint(state, 2));
+        acb_dft(w2, v, len, prec);
+        acb_dft_cache_set_enabled(1);
+
+        if (!_acb_vec_equal_check(w1, w2, len))
+        {
+            flint_printf("FAIL (cache)  len = %wd, prec = %wd\n\n", len, prec);
+            flint_abort();
+        }
+
+        acb_dft_precomp_clear(pre1);
+        _acb_vec_clear(v, len);
+        _acb_vec_clear(w1, len);
+        _acb_vec_clear(w2, len);
+    }
+
+    /* malformed plans are rejected */
+    for (iter = 0; iter < 4; iter++)
+    {
+        acb_dft_pre_t pre;
+        arb_t x;
+        FILE * tmp;
+
+        tmp = tmpfile();
+        if (tmp == NULL)
+        {
+            flint_printf("FAIL (creating temporary file)  iter = %wd\n\n", iter);
+            flint_abort();
+        }
+
+        arb_init(x);
+
+        if (iter == 0)
+        {
+            /* radix 2 plan of length 4 claiming length 8 */
+            flint_fprintf(tmp, "acb_dft 2 64 \n%d 8 2 1 \n", DFT_RAD2);
+            for (k = 0; k < 4; k++)
+            {
+                arb_dump_file(tmp, x);
+                fputc(' ', tmp);
+            }
+        }
+        else if (iter == 1)
+        {
+            /* step length 4 does not divide 6 */
+            flint_fprintf(tmp, "acb_dft 2 64 \n%d 6 2 4 2 2 0 0 ", DFT_PROD);
+        }
+        else if (iter == 2)
+        {
+            /* a single step of length 2 leaves a factor 3 of the length */
+            flint_fprintf(tmp, "acb_dft 2 64 \n%d 6 1 2 1 1 0 0 ", DFT_PROD);
+        }
+        else
+        {
+            /* Bluestein scheme of length 101 with a convolution of length 4 */
+            flint_fprintf(tmp, "acb_dft 2 64 \n%d 101 1 2 1 \n", DFT_CONV);
+            for (k = 0; k < 4; k++)
+            {
+                arb_dump_file(tmp, x);
+                fputc(' ', tmp);
+            }
+        }
+
+        fflush(tmp);
+        rewind(tmp);
+
+        if (!acb_dft_precomp_load_file(pre, tmp))
+        {
+            flint_printf("FAIL (malformed)  iter = %wd\n\n", iter);
+            flint_abort();
+        }
+
+        fclose(tmp);
+        arb_clear(x);
+    }
+
+#endif
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -39,8 +39,10 @@ void acb_dirichlet_zeta_deriv_bound(mag_t der1, mag_t der2, const acb_t s);
 void acb_dirichlet_zeta_rs_f_coeffs(acb_ptr c, const arb_t p, slong N, slong prec);
 void acb_dirichlet_zeta_rs_d_coeffs(arb_ptr d, const arb_t sigma, slong k, slong prec);
 void acb_dirichlet_zeta_rs_bound(mag_t err, const acb_t s, slong K);
+void _acb_dirichlet_zeta_rs_r(acb_t res, ulong * N, const acb_t s, slong K, int powsum, slong prec);
 void acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec);
 void acb_dirichlet_zeta_rs(acb_t res, const acb_t s, slong K, slong prec);
+void acb_dirichlet_zeta_rs_vec(acb_ptr res, const acb_t s, const arb_t h, slong num, slong K, slong prec);
 void acb_dirichlet_zeta(acb_t res, const acb_t s, slong prec);
 
 void acb_dirichlet_zeta_jet_rs(acb_ptr res, const acb_t s, slong len, slong prec);
@@ -311,6 +313,12 @@ slong acb_dirichlet_platt_local_hardy_z_zeros(
     arb_ptr res, const fmpz_t n, slong len, slong prec);
 slong acb_dirichlet_platt_hardy_z_zeros(
     arb_ptr res, const fmpz_t n, slong len, slong prec);
+slong _acb_dirichlet_platt_hardy_z_zeros(arb_ptr res, const fmpz_t n,
+    slong len, FILE * checkpoint, slong prec);
+int _acb_dirichlet_platt_zeros_write_block(FILE * stream,
+    const fmpz_t n, arb_srcptr z, slong r, slong prec);
+slong acb_dirichlet_platt_hardy_z_zeros_checkpoint(arb_ptr res,
+    const fmpz_t n, slong len, const char * filename, slong prec);
 
 /* Discrete Fourier Transform */
 
@@ -1093,6 +1093,50 @@ _isolate_hardy_z_zeros(arf_interval_ptr res, const fmpz_t n, slong len)
     return count;
 }
 
+/* Isolate the zeros with index n, ..., n + len - 1 of one chunk. */
+static void
+_isolate_hardy_z_zeros_range(arf_interval_ptr res, const fmpz_t n, slong len)
+{
+    slong c = 0;
+    fmpz_t k;
+    fmpz_init(k);
+    while (c < len)
+    {
+        fmpz_add_si(k, n, c);
+        c += _isolate_hardy_z_zeros(res + c, k, len - c);
+    }
+    fmpz_clear(k);
+}
+
+/*
+ * Long ranges are cut into chunks of ISOLATE_CHUNK consecutive zeros which
+ * are isolated independently, each starting from its own separated list of
+ * good Gram points. The chunk size does not depend on the number of
+ * threads, so neither do the isolating intervals.
+ */
+#define ISOLATE_CHUNK 128
+
+typedef struct
+{
+    arf_interval_ptr res;
+    const fmpz * n;
+    slong len;
+}
+isolate_work_t;
+
+static void
+isolate_worker(slong i, isolate_work_t * work)
+{
+    fmpz_t k;
+    slong c = i * ISOLATE_CHUNK;
+
+    fmpz_init(k);
+    fmpz_add_si(k, work->n, c);
+    _isolate_hardy_z_zeros_range(work->res + c, k,
+        FLINT_MIN(ISOLATE_CHUNK, work->len - c));
+    fmpz_clear(k);
+}
+
 /* Isolate len zeros, starting from the nth zero. */
 void
 acb_dirichlet_isolate_hardy_z_zeros(arf_interval_ptr res, const fmpz_t n, slong len)
@@ -1106,17 +1150,18 @@ acb_dirichlet_isolate_hardy_z_zeros(arf_interval_ptr res, const fmpz_t n, slong
         flint_printf("nonpositive indices of zeros are not supported\n");
         flint_abort();
     }
+    else if (len <= ISOLATE_CHUNK)
+    {
+        _isolate_hardy_z_zeros_range(res, n, len);
+    }
     else
     {
-        slong c = 0;
-        fmpz_t k;
-        fmpz_init(k);
-        while (c < len)
-        {
-            fmpz_add_si(k, n, c);
-            c += _isolate_hardy_z_zeros(res + c, k, len - c);
-        }
-        fmpz_clear(k);
+        isolate_work_t work;
+        work.res = res;
+        work.n = n;
+        work.len = len;
+        flint_parallel_do((do_func_t) isolate_worker, &work,
+            (len + ISOLATE_CHUNK - 1) / ISOLATE_CHUNK, -1, FLINT_PARALLEL_DYNAMIC);
     }
 }
 
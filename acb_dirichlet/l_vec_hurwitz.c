@@ -9,17 +9,77 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_dirichlet.h"
 #include "acb_poly.h"
 
+/* number of Hurwitz zeta values computed by one task */
+#define L_VEC_HURWITZ_CHUNK 64
+
+typedef struct
+{
+    acb_ptr zeta;
+    const ulong * n;
+    const acb_struct * s;
+    const acb_struct * qs;
+    const acb_dirichlet_hurwitz_precomp_struct * precomp;
+    ulong q;
+    slong len;
+    int deflate;
+    slong prec;
+}
+_l_vec_hurwitz_work_t;
+
+/* conj(q^-s zeta(s, n/q)) for the n in the i-th chunk; the precomputed
+   table is only read, so it is shared by all threads */
+static void
+_l_vec_hurwitz_worker(slong i, _l_vec_hurwitz_work_t * w)
+{
+    slong k, k0, k1;
+    acb_t a;
+
+    k0 = i * L_VEC_HURWITZ_CHUNK;
+    k1 = FLINT_MIN(k0 + L_VEC_HURWITZ_CHUNK, w->len);
+
+    acb_init(a);
+
+    for (k = k0; k < k1; k++)
+    {
+        acb_ptr z = w->zeta + k;
+
+        if (w->precomp == NULL)
+        {
+            acb_set_ui(a, w->n[k]);
+            acb_div_ui(a, a, w->q, w->prec);
+
+            if (w->deflate == 0)
+                acb_hurwitz_zeta(z, w->s, a, w->prec);
+            else
+                _acb_poly_zeta_cpx_series(z, w->s, a, 1, 1, w->prec);
+        }
+        else
+        {
+            acb_dirichlet_hurwitz_precomp_eval(z, w->precomp, w->n[k], w->q, w->prec);
+        }
+
+        acb_mul(z, z, w->qs, w->prec);
+        acb_conj(z, z);
+    }
+
+    acb_clear(a);
+}
+
 void
 acb_dirichlet_l_vec_hurwitz(acb_ptr res, const acb_t s,
     const acb_dirichlet_hurwitz_precomp_t precomp,
     const dirichlet_group_t G, slong prec)
 {
+    _l_vec_hurwitz_work_t work;
     acb_t a, qs;
-    acb_ptr zeta, z;
+    acb_ptr zeta;
+    ulong * n;
     dirichlet_char_t cn;
+    slong k, nchunks;
     int deflate;
 
     /* remove pole in Hurwitz zeta at s = 1 */
@@ -35,45 +95,52 @@ acb_dirichlet_l_vec_hurwitz(acb_ptr res, const acb_t s,
     acb_neg(a, s);
     acb_pow(qs, qs, a, prec);
 
-    zeta = z = _acb_vec_init(G->phi_q);
+    /* the residues in Conrey order */
+    n = flint_malloc(sizeof(ulong) * G->phi_q);
+    k = 0;
     dirichlet_char_one(cn, G);
     do {
-        if (precomp == NULL)
-        {
-            acb_set_ui(a, cn->n);
-            acb_div_ui(a, a, G->q, prec);
-
-            if (deflate == 0)
-                acb_hurwitz_zeta(z, s, a, prec);
-            else
-                _acb_poly_zeta_cpx_series(z, s, a, 1, 1, prec);
-        }
-        else
-        {
-            acb_dirichlet_hurwitz_precomp_eval(z, precomp, cn->n, G->q, prec);
-        }
+        n[k++] = cn->n;
+    } while (dirichlet_char_next(cn, G) >= 0);
 
-        acb_mul(z, z, qs, prec);
-        acb_conj(z, z);
+    zeta = _acb_vec_init(G->phi_q);
 
-        z++;
-    } while (dirichlet_char_next(cn, G) >= 0);
+    work.zeta = zeta;
+    work.n = n;
+    work.s = s;
+    work.qs = qs;
+    work.precomp = precomp;
+    work.q = G->q;
+    work.len = G->phi_q;
+    work.deflate = deflate;
+    work.prec = prec;
 
-    acb_dirichlet_dft_index(res, zeta, G, prec);
+    nchunks = (G->phi_q + L_VEC_HURWITZ_CHUNK - 1) / L_VEC_HURWITZ_CHUNK;
 
+    if (nchunks > 1 && flint_get_num_threads() > 1)
+    {
+        flint_parallel_do((do_func_t) _l_vec_hurwitz_worker, &work, nchunks, -1,
+            FLINT_PARALLEL_DYNAMIC);
+    }
+    else
     {
-        slong k;
-        for (k = 0; k < G->phi_q; k++)
-            acb_conj(res + k, res + k);
+        for (k = 0; k < nchunks; k++)
+            _l_vec_hurwitz_worker(k, &work);
     }
 
+    /* the product transform is distributed over threads by acb_dft_step */
+    acb_dirichlet_dft_index(res, zeta, G, prec);
+
+    for (k = 0; k < G->phi_q; k++)
+        acb_conj(res + k, res + k);
+
     /* restore pole for the principal character */
     if (deflate)
         acb_indeterminate(res);
 
     dirichlet_char_clear(cn);
     _acb_vec_clear(zeta, G->phi_q);
+    flint_free(n);
     acb_clear(qs);
     acb_clear(a);
 }
-
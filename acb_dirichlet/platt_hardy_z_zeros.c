@@ -9,8 +9,95 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <stdio.h>
+#include <string.h>
 #include "acb_dirichlet.h"
 
+/*
+ * A checkpoint file starts with a header line and then contains one
+ * record per finished block:
+ *
+ *     n r prec
+ *     (r zeros in the format of arb_dump_file)
+ *     end
+ *
+ * where n is the index of the first zero of the block. A record that was
+ * only partially written (say, because the process was killed) is
+ * discarded when the file is read back.
+ */
+
+#define PLATT_CHECKPOINT_VERSION 1
+
+int
+_acb_dirichlet_platt_zeros_write_block(FILE * stream,
+        const fmpz_t n, arb_srcptr z, slong r, slong prec)
+{
+    slong i;
+
+    if (fmpz_fprint(stream, n) <= 0 ||
+        flint_fprintf(stream, " %wd %wd\n", r, prec) < 0)
+        return 1;
+
+    for (i = 0; i < r; i++)
+    {
+        if (arb_dump_file(stream, z + i) || fputc('\n', stream) == EOF)
+            return 1;
+    }
+
+    if (fputs("end\n", stream) == EOF || fflush(stream) != 0)
+        return 1;
+
+    return 0;
+}
+
+/* Reads consecutive complete records starting with the n-th zero
+   at precision prec; returns the number of zeros read into res. */
+static slong
+_platt_zeros_read(arb_ptr res, const fmpz_t n, slong len, FILE * stream, slong prec)
+{
+    char tag[32];
+    int version;
+    slong s, r, p, i;
+    fmpz_t m;
+    arb_t z;
+
+    if (fscanf(stream, "%31s %d", tag, &version) != 2 ||
+        strcmp(tag, "platt_zeros") != 0 || version != PLATT_CHECKPOINT_VERSION)
+        return 0;
+
+    fmpz_init(m);
+    arb_init(z);
+
+    for (s = 0; s < len; s += r)
+    {
+        if (fmpz_fread(stream, m) <= 0 || flint_fscanf(stream, "%wd %wd", &r, &p) != 2)
+            break;
+
+        fmpz_sub(m, m, n);
+        if (r <= 0 || p != prec || !fmpz_equal_si(m, s))
+            break;
+
+        /* zeros beyond len are read but dropped */
+        for (i = 0; i < r; i++)
+        {
+            if (arb_load_file(z, stream))
+                break;
+            if (s + i < len)
+                arb_swap(res + s + i, z);
+        }
+
+        if (i < r || fscanf(stream, "%31s", tag) != 1 || strcmp(tag, "end") != 0)
+            break;
+
+        r = FLINT_MIN(r, len - s);
+    }
+
+    fmpz_clear(m);
+    arb_clear(z);
+
+    return s;
+}
+
 slong
 acb_dirichlet_platt_hardy_z_zeros(
         arb_ptr res, const fmpz_t n, slong len, slong prec)
@@ -26,17 +113,91 @@ acb_dirichlet_platt_hardy_z_zeros(
     }
     else
     {
-        slong r, s;
+        return _acb_dirichlet_platt_hardy_z_zeros(res, n, len, NULL, prec);
+    }
+    return 0;
+}
+
+slong
+acb_dirichlet_platt_hardy_z_zeros_checkpoint(arb_ptr res,
+        const fmpz_t n, slong len, const char * filename, slong prec)
+{
+    if (len <= 0 || fmpz_sizeinbase(n, 10) < 5)
+    {
+        return 0;
+    }
+    else if (fmpz_sgn(n) < 1)
+    {
+        flint_printf("Nonpositive indices of Hardy Z zeros are not supported.\n");
+        flint_abort();
+    }
+    else
+    {
+        slong s = 0;
         fmpz_t k;
+        FILE * stream;
+        char * tmpname;
+
+        stream = fopen(filename, "r");
+        if (stream != NULL)
+        {
+            s = _platt_zeros_read(res, n, len, stream, prec);
+            fclose(stream);
+        }
+
+        /* rewrite the file with the valid zeros as a single record,
+           dropping any incomplete or mismatching data; the new contents
+           are written to a temporary file which then replaces the old one,
+           so that an interruption never loses the saved zeros */
+        tmpname = flint_malloc(strlen(filename) + 5);
+        strcpy(tmpname, filename);
+        strcat(tmpname, ".tmp");
+
+        stream = fopen(tmpname, "w");
+        if (stream == NULL)
+        {
+            flint_printf("unable to open checkpoint file %s\n", tmpname);
+            flint_abort();
+        }
+
         fmpz_init(k);
         fmpz_set(k, n);
-        for (s = 0; s < len; s += r)
+
+        if (flint_fprintf(stream, "platt_zeros %d\n", PLATT_CHECKPOINT_VERSION) < 0 ||
+            (s > 0 && _acb_dirichlet_platt_zeros_write_block(stream, k, res, s, prec)) ||
+            fflush(stream) != 0 || fclose(stream) != 0)
         {
-            r = acb_dirichlet_platt_local_hardy_z_zeros(res + s, k, len - s, prec);
-            if (!r)
-                break;
-            fmpz_add_si(k, k, r);
+            flint_printf("unable to write checkpoint file %s\n", tmpname);
+            flint_abort();
         }
+
+        /* rename does not replace an existing file on some systems */
+        if (rename(tmpname, filename) != 0 &&
+            (remove(filename) != 0 || rename(tmpname, filename) != 0))
+        {
+            flint_printf("unable to replace checkpoint file %s\n", filename);
+            flint_abort();
+        }
+
+        flint_free(tmpname);
+
+        /* new blocks are appended */
+        stream = fopen(filename, "a");
+        if (stream == NULL)
+        {
+            flint_printf("unable to open checkpoint file %s\n", filename);
+            flint_abort();
+        }
+
+        if (s < len)
+        {
+            fmpz_add_si(k, k, s);
+            s += _acb_dirichlet_platt_hardy_z_zeros(res + s, k, len - s, stream, prec);
+        }
+
+        fclose(stream);
+        fmpz_clear(k);
+
         return s;
     }
     return 0;
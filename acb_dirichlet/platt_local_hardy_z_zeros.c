@@ -11,6 +11,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_dirichlet.h"
 #include "arb_calc.h"
 
@@ -1528,3 +1529,102 @@ acb_dirichlet_platt_local_hardy_z_zeros(
     }
     return 0;
 }
+
+
+/*
+ * Pipelined driver for consecutive blocks of zeros. Once the zeros of a
+ * block have been isolated, the index of the first zero of the next block
+ * is known, so the grid evaluation for the next block is run as one task
+ * alongside the refinement of the zeros of the current block, one task
+ * per zero. The results do not depend on the number of threads.
+ */
+
+typedef struct
+{
+    arb_ptr res;
+    arf_interval_srcptr p;
+    platt_ctx_srcptr ctx;
+    platt_ctx_ptr next;
+    const fmpz * n_next;
+    int build_next;
+    slong prec;
+}
+platt_block_work_t;
+
+static void
+platt_block_worker(slong i, platt_block_work_t * work)
+{
+    if (work->build_next)
+    {
+        if (i == 0)
+        {
+            work->next = _create_heuristic_context(work->n_next, work->prec);
+            return;
+        }
+        i--;
+    }
+
+    _refine_local_hardy_z_zero_illinois(work->res + i, work->ctx,
+        &work->p[i].a, &work->p[i].b, work->prec);
+}
+
+slong
+_acb_dirichlet_platt_hardy_z_zeros(arb_ptr res, const fmpz_t n, slong len,
+        FILE * checkpoint, slong prec)
+{
+    slong r, s;
+    fmpz_t k;
+    arf_interval_ptr p;
+    platt_ctx_ptr ctx;
+    platt_block_work_t work;
+
+    fmpz_init(k);
+    fmpz_set(k, n);
+    p = _arf_interval_vec_init(len);
+    ctx = _create_heuristic_context(k, prec);
+
+    for (s = 0; s < len && ctx != NULL; s += r)
+    {
+        r = _isolate_zeros(p, ctx, k, len - s, prec);
+        if (!r)
+            break;
+
+        work.res = res + s;
+        work.p = p;
+        work.ctx = ctx;
+        work.next = NULL;
+        work.build_next = (s + r < len);
+        work.prec = prec;
+        fmpz_add_si(k, k, r);
+        work.n_next = k;
+
+        flint_parallel_do((do_func_t) platt_block_worker, &work,
+            r + work.build_next, -1, FLINT_PARALLEL_DYNAMIC);
+
+        if (checkpoint != NULL)
+        {
+            fmpz_sub_si(k, k, r);
+            if (_acb_dirichlet_platt_zeros_write_block(checkpoint, k, res + s, r, prec))
+            {
+                flint_printf("unable to write checkpoint\n");
+                flint_abort();
+            }
+            fmpz_add_si(k, k, r);
+        }
+
+        platt_ctx_clear(ctx);
+        free(ctx);
+        ctx = work.next;
+    }
+
+    if (ctx != NULL)
+    {
+        platt_ctx_clear(ctx);
+        free(ctx);
+    }
+
+    _arf_interval_vec_clear(p, len);
+    fmpz_clear(k);
+
+    return s;
+}
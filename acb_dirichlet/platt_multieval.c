@@ -594,8 +594,8 @@ _acb_dirichlet_platt_multieval(arb_ptr out, acb_srcptr S_table,
         {
             acb_swap(row + i, row + i + N/2);
         }
-        acb_dft_precomp(row, row, pre_N, prec);
     }
+    acb_dft_precomp_many(table, N, table, N, K, pre_N, prec);
     _acb_vec_scalar_div_ui(table, table, N*K, (ulong) A, prec);
 
     for (k = 0; k < K; k++)
@@ -10,8 +10,11 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_dirichlet.h"
-#include "pthread.h"
+
+/* Minimum number of terms j per thread. */
+#define PLATT_THREADED_MIN_TERMS 1000
 
 slong platt_get_smk_index(slong B, const fmpz_t j, slong prec);
 void get_smk_points(slong * res, slong A, slong B);
@@ -43,14 +46,12 @@ typedef struct
 }
 platt_smk_arg_t;
 
-static void *
-_platt_smk_thread(void * arg_ptr)
+static void
+_platt_smk_worker(slong i, platt_smk_arg_t * args)
 {
-    platt_smk_arg_t *p = (platt_smk_arg_t *) arg_ptr;
+    platt_smk_arg_t *p = args + i;
     _platt_smk(p->S, p->startvec, p->stopvec, p->smk_points, p->t0, p->A, p->B,
                p->jstart, p->jstop, p->mstart, p->mstop, p->K, p->prec);
-    flint_cleanup();
-    return NULL;
 }
 
 
@@ -61,7 +62,6 @@ acb_dirichlet_platt_multieval_threaded(arb_ptr out, const fmpz_t T, slong A,
 {
     slong i, num_threads, N;
     fmpz * smk_points;
-    pthread_t * threads;
     platt_smk_arg_t * args;
     acb_ptr S;
     arb_t t0;
@@ -74,9 +74,15 @@ acb_dirichlet_platt_multieval_threaded(arb_ptr out, const fmpz_t T, slong A,
         flint_abort();
     }
 
+    /* don't split small sums */
+    if (fmpz_cmp_si(J, num_threads * PLATT_THREADED_MIN_TERMS) < 0)
+    {
+        num_threads = FLINT_MAX(1, fmpz_get_si(J) / PLATT_THREADED_MIN_TERMS);
+        num_threads = FLINT_MIN(num_threads, flint_get_num_threads());
+    }
+
     N = A*B;
     fmpz_init(threadtasks);
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
     args = flint_malloc(sizeof(platt_smk_arg_t) * num_threads);
     fmpz_add_si(threadtasks, J, num_threads - 1);
     fmpz_tdiv_q_ui(threadtasks, threadtasks, (ulong) num_threads);
@@ -109,15 +115,11 @@ acb_dirichlet_platt_multieval_threaded(arb_ptr out, const fmpz_t T, slong A,
     fmpz_set(args[num_threads-1].jstop, J);
     args[num_threads-1].mstop = platt_get_smk_index(B, J, prec);
 
-    for (i = 0; i < num_threads; i++)
-    {
-        pthread_create(&threads[i], NULL, _platt_smk_thread, &args[i]);
-    }
-
-    for (i = 0; i < num_threads; i++)
-    {
-        pthread_join(threads[i], NULL);
-    }
+    if (num_threads == 1)
+        _platt_smk_worker(0, args);
+    else
+        flint_parallel_do((do_func_t) _platt_smk_worker, args, num_threads,
+            -1, FLINT_PARALLEL_UNIFORM);
 
     for (i = 0; i < num_threads; i++)
     {
@@ -143,5 +145,4 @@ acb_dirichlet_platt_multieval_threaded(arb_ptr out, const fmpz_t T, slong A,
     _fmpz_vec_clear(smk_points, N);
 
     flint_free(args);
-    flint_free(threads);
 }
@@ -94,6 +94,64 @@ int main()
         _arb_vec_clear(p, maxlen);
     }
 
+    /* long ranges are isolated in chunks, possibly in parallel */
+    {
+        const slong len = 300;
+        slong i, prec = 32;
+        arb_ptr p, q;
+        arb_t x;
+        fmpz_t n, k;
+
+        p = _arb_vec_init(len);
+        q = _arb_vec_init(len);
+        arb_init(x);
+        fmpz_init(n);
+        fmpz_init(k);
+
+        fmpz_set_ui(n, 1 + n_randint(state, 10000));
+
+        acb_dirichlet_hardy_z_zeros(p, n, len, prec);
+        flint_set_num_threads(2 + n_randint(state, 3));
+        acb_dirichlet_hardy_z_zeros(q, n, len, prec);
+        flint_set_num_threads(1);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_equal(p + i, q + i) ||
+                (i > 0 && !arb_lt(p + i - 1, p + i)))
+            {
+                flint_printf("FAIL: chunks\n\n");
+                flint_printf("n = "); fmpz_print(n);
+                flint_printf("   i = %wd\n\n", i);
+                flint_printf("p = "); arb_printn(p + i, 50, 0); flint_printf("\n\n");
+                flint_printf("q = "); arb_printn(q + i, 50, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        for (i = 127; i <= 128; i++)
+        {
+            fmpz_add_si(k, n, i);
+            acb_dirichlet_hardy_z_zero(x, k, prec);
+
+            if (!arb_overlaps(x, p + i))
+            {
+                flint_printf("FAIL: chunk boundary\n\n");
+                flint_printf("n = "); fmpz_print(n);
+                flint_printf("   i = %wd\n\n", i);
+                flint_printf("x = "); arb_printn(x, 50, 0); flint_printf("\n\n");
+                flint_printf("p = "); arb_printn(p + i, 50, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _arb_vec_clear(p, len);
+        _arb_vec_clear(q, len);
+        arb_clear(x);
+        fmpz_clear(n);
+        fmpz_clear(k);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
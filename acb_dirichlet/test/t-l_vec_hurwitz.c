@@ -110,6 +110,56 @@ int main()
         acb_dirichlet_hurwitz_precomp_clear(pre);
     }
 
+    /* threaded evaluation gives identical results */
+    for (iter = 0; iter < 5 * arb_test_multiplier(); iter++)
+    {
+        ulong q, i;
+        slong prec;
+        dirichlet_group_t G;
+        acb_t s;
+        acb_ptr v, w;
+        acb_dirichlet_hurwitz_precomp_t pre;
+        int use_pre;
+
+        prec = 30 + n_randint(state, 50);
+        q = 100 + n_randint(state, 300);
+        use_pre = n_randint(state, 2);
+
+        dirichlet_group_init(G, q);
+
+        acb_init(s);
+        acb_set_d_d(s, 0.5, n_randint(state, 20));
+
+        v = _acb_vec_init(G->phi_q);
+        w = _acb_vec_init(G->phi_q);
+
+        acb_dirichlet_hurwitz_precomp_init_num(pre, s, acb_is_one(s), G->phi_q, prec);
+
+        flint_set_num_threads(1);
+        acb_dirichlet_l_vec_hurwitz(v, s, use_pre ? pre : NULL, G, prec);
+        flint_set_num_threads(2 + n_randint(state, 3));
+        acb_dirichlet_l_vec_hurwitz(w, s, use_pre ? pre : NULL, G, prec);
+        flint_set_num_threads(1);
+
+        for (i = 0; i < G->phi_q; i++)
+        {
+            if (!acb_equal(v + i, w + i))
+            {
+                flint_printf("FAIL: threads\n\n");
+                flint_printf("q = %wu, i = %wu\n\n", q, i);
+                acb_printd(v + i, 30); flint_printf("\n\n");
+                acb_printd(w + i, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_clear(s);
+        _acb_vec_clear(v, G->phi_q);
+        _acb_vec_clear(w, G->phi_q);
+        dirichlet_group_clear(G);
+        acb_dirichlet_hurwitz_precomp_clear(pre);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
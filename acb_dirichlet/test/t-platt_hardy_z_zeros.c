@@ -50,6 +50,65 @@ int main()
         }
     }
 
+    /* resuming from a checkpoint, with a partially written last record */
+    {
+        const char * filename = "platt_hardy_z_zeros_checkpoint";
+        const char * tmpname = "platt_hardy_z_zeros_checkpoint.tmp";
+        FILE * stream;
+        slong c;
+
+        remove(filename);
+        remove(tmpname);
+        flint_set_num_threads(2);
+
+        c = acb_dirichlet_platt_hardy_z_zeros_checkpoint(pa, n, 20, filename, prec);
+        count = acb_dirichlet_platt_hardy_z_zeros_checkpoint(pa, n, maxcount, filename, prec);
+
+        stream = fopen(filename, "a");
+        fputs("10100 7 64\n", stream);
+        fclose(stream);
+
+        /* an interrupted rewrite leaves an incomplete temporary file,
+           which must neither be read nor replace the saved zeros */
+        stream = fopen(tmpname, "w");
+        fputs("platt_zeros 1\n10000 1 64\n1 0 0 0\n", stream);
+        fclose(stream);
+
+        _arb_vec_zero(pa, maxcount);
+        c = acb_dirichlet_platt_hardy_z_zeros_checkpoint(pa, n, maxcount, filename, prec);
+
+        stream = fopen(tmpname, "r");
+        if (stream != NULL)
+        {
+            flint_printf("FAIL: temporary checkpoint file was not replaced\n\n");
+            flint_abort();
+        }
+
+        remove(filename);
+
+        if (c != maxcount || count != maxcount)
+        {
+            flint_printf("FAIL: checkpoint count\n\n");
+            flint_printf("c = %wd  count = %wd  maxcount = %wd\n\n", c, count, maxcount);
+            flint_abort();
+        }
+
+        for (i = 0; i < maxcount; i++)
+        {
+            if (!arb_overlaps(pa+i, pb+i))
+            {
+                flint_printf("FAIL: checkpoint overlap\n\n");
+                flint_printf("observed[%wd] = ", i);
+                arb_printd(pa+i, 20); flint_printf("\n\n");
+                flint_printf("expected[%wd] = ", i);
+                arb_printd(pb+i, 20); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        flint_set_num_threads(1);
+    }
+
     fmpz_clear(n);
     _arb_vec_clear(pa, maxcount);
     _arb_vec_clear(pb, maxcount);
@@ -0,0 +1,139 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("zeta_rs_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 20 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr z1;
+        acb_t z2, s, t;
+        arb_t h;
+        slong j, num, prec1, prec2, K;
+
+        num = 1 + n_randint(state, 100);
+
+        z1 = _acb_vec_init(num);
+        acb_init(z2);
+        acb_init(s);
+        acb_init(t);
+        arb_init(h);
+
+        if (n_randint(state, 2))
+            arb_set_d(acb_realref(s), 0.5);
+        else
+            arb_set_si(acb_realref(s), n_randint(state, 5) - 2);
+
+        arb_set_ui(acb_imagref(s), 100 + n_randint(state, 100000));
+        arb_set_ui(h, 1 + n_randint(state, 100));
+        arb_mul_2exp_si(h, h, -(slong) n_randint(state, 10));
+
+        prec1 = 2 + n_randint(state, 150);
+        prec2 = 2 + n_randint(state, 150);
+        K = n_randint(state, 10);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+        acb_dirichlet_zeta_rs_vec(z1, s, h, num, K, prec1);
+
+        for (j = 0; j < num; j++)
+        {
+            acb_set(t, s);
+            arb_addmul_si(acb_imagref(t), h, j, ARF_PREC_EXACT);
+            acb_dirichlet_zeta_rs(z2, t, 0, prec2);
+
+            if (!acb_overlaps(z1 + j, z2))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("iter = %wd, j = %wd, K = %wd\n\n", iter, j, K);
+                flint_printf("s = "); acb_printn(t, 50, 0); flint_printf("\n\n");
+                flint_printf("z1 = "); acb_printn(z1 + j, 50, 0); flint_printf("\n\n");
+                flint_printf("z2 = "); acb_printn(z2, 50, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _acb_vec_clear(z1, num);
+        acb_clear(z2);
+        acb_clear(s);
+        acb_clear(t);
+        arb_clear(h);
+    }
+
+    /* more points than one multi-evaluation block */
+    for (iter = 0; iter < 1 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr z1;
+        acb_t z2, s, t;
+        arb_t h;
+        slong j, num, prec, K;
+
+        num = 4097 + n_randint(state, 300);
+
+        z1 = _acb_vec_init(num);
+        acb_init(z2);
+        acb_init(s);
+        acb_init(t);
+        arb_init(h);
+
+        if (n_randint(state, 2))
+            arb_set_d(acb_realref(s), 0.5);
+        else
+            arb_set_si(acb_realref(s), n_randint(state, 3) - 1);
+
+        arb_set_ui(acb_imagref(s), 1000 + n_randint(state, 10000));
+        arb_one(h);
+        arb_mul_2exp_si(h, h, -(slong) n_randint(state, 6));
+
+        prec = 32 + n_randint(state, 100);
+        K = n_randint(state, 10);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+        acb_dirichlet_zeta_rs_vec(z1, s, h, num, K, prec);
+
+        for (j = 0; j < num; j++)
+        {
+            acb_set(t, s);
+            arb_addmul_si(acb_imagref(t), h, j, ARF_PREC_EXACT);
+            acb_dirichlet_zeta_rs(z2, t, 0, prec);
+
+            if (!acb_overlaps(z1 + j, z2))
+            {
+                flint_printf("FAIL: overlap (blocks)\n\n");
+                flint_printf("iter = %wd, num = %wd, j = %wd, K = %wd\n\n", iter, num, j, K);
+                flint_printf("s = "); acb_printn(t, 50, 0); flint_printf("\n\n");
+                flint_printf("z1 = "); acb_printn(z1 + j, 50, 0); flint_printf("\n\n");
+                flint_printf("z2 = "); acb_printn(z2, 50, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _acb_vec_clear(z1, num);
+        acb_clear(z2);
+        acb_clear(s);
+        acb_clear(t);
+        arb_clear(h);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -11,8 +11,12 @@
 
 #include "acb_dirichlet.h"
 
+/* If Nout is not NULL, sets *Nout to the length N of the main sum, or to
+   zero if the result is indeterminate. If powsum is zero, the main sum
+   sum_{n <= N} n^(-s) is omitted from the result. */
 void
-acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
+_acb_dirichlet_zeta_rs_r(acb_t res, ulong * Nout, const acb_t s, slong K,
+    int powsum, slong prec)
 {
     arb_ptr dk, pipow;
     acb_ptr Fp;
@@ -22,6 +26,9 @@ acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
     mag_t err;
     slong j, k, wp, K_limit;
 
+    if (Nout != NULL)
+        *Nout = 0;
+
     /* determinate K automatically */
     if (K <= 0)
     {
@@ -202,12 +209,18 @@ acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
     if (fmpz_is_even(N))
         acb_neg(S, S);
 
-    if (_acb_vec_estimate_allocated_bytes(fmpz_get_ui(N) / 6, wp) < 4e9)
-        acb_dirichlet_powsum_sieved(u, s, fmpz_get_ui(N), 1, wp);
-    else
-        acb_dirichlet_powsum_smooth(u, s, fmpz_get_ui(N), 1, wp);
+    if (powsum)
+    {
+        if (_acb_vec_estimate_allocated_bytes(fmpz_get_ui(N) / 6, wp) < 4e9)
+            acb_dirichlet_powsum_sieved(u, s, fmpz_get_ui(N), 1, wp);
+        else
+            acb_dirichlet_powsum_smooth(u, s, fmpz_get_ui(N), 1, wp);
+
+        acb_add(S, S, u, wp);
+    }
 
-    acb_add(S, S, u, wp);
+    if (Nout != NULL)
+        *Nout = fmpz_get_ui(N);
 
     acb_set(res, S);  /* don't set_round here; the extra precision is useful */
 
@@ -230,3 +243,9 @@ cleanup:
     mag_clear(err);
 }
 
+
+void
+acb_dirichlet_zeta_rs_r(acb_t res, const acb_t s, slong K, slong prec)
+{
+    _acb_dirichlet_zeta_rs_r(res, NULL, s, K, 1, prec);
+}
@@ -0,0 +1,435 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "acb_dirichlet.h"
+#include "acb_dft.h"
+
+/* below this many points, evaluate each point separately */
+#define ZETA_RS_VEC_MIN_NUM 32
+
+/* number of points per multi-evaluation block (bounds the memory) */
+#define ZETA_RS_VEC_BLOCK 4096
+
+/*
+Sets res[j] = sum_{n=1}^{N} n^(-sigma - i (t0 + j h)) for 0 <= j < M,
+given logn[n-1] = log(n).
+
+This is a simple variant of the Odlyzko-Schonhage algorithm. With
+L = 2M, each frequency log(n) is written as 2 pi m / (L h) + eps where
+m is an integer and |eps| <= pi / (L h). With c = floor(M/2), we have
+
+    e^(-i j h log(n)) = e^(-2 pi i j m / L) e^(-i c h eps) e^(-i (j-c) h eps)
+
+and expanding the last factor in a Taylor series gives
+
+    res[j] = sum_{k < K} (-i (j-c) h)^k / k! * D_k[j]
+
+where D_k is the length L DFT of the vector whose m-th entry collects
+n^(-sigma - i t0) e^(-i c h eps) eps^k for all n in bin m. Since
+|(j-c) h eps| <= pi/4, the Taylor series converges quickly, and the tail
+is bounded by B x^K / K! / (1 - x/(K+1)) where x = |j-c| h max |eps|
+and B = sum |n^(-sigma)|.
+*/
+static void
+_acb_dirichlet_powsum_multieval(acb_ptr res, const arb_t sigma, const arb_t t0,
+    const arb_t h, arb_srcptr logn, ulong N, slong M, slong prec)
+{
+    slong L, c, K, k, j, m;
+    ulong n;
+    double x, log2B, log2term, sigmad;
+    acb_ptr D;
+    acb_t z, y;
+    arb_t scale, step, ch, eps, phase, t;
+    mag_t B, epsmax, xm, u, err;
+    acb_dft_pre_t pre;
+
+    L = 2 * M;
+    c = M / 2;
+
+    /* choose the number of Taylor terms */
+    sigmad = arf_get_d(arb_midref(sigma), ARF_RND_DOWN);
+    log2B = log(N) * 1.4426950408889634 * (1.0 + FLINT_MAX(0.0, -sigmad)) + 1.0;
+    x = 3.1415926535897932 * c / L + 1e-6;
+    log2term = 0.0;
+    for (K = 1; K < 4 * prec + 10; K++)
+    {
+        log2term += log(x / K) * 1.4426950408889634;
+        if (log2term + log2B < -prec)
+            break;
+    }
+
+    D = _acb_vec_init(K * L);
+    acb_init(z);
+    acb_init(y);
+    arb_init(scale);
+    arb_init(step);
+    arb_init(ch);
+    arb_init(eps);
+    arb_init(phase);
+    arb_init(t);
+    mag_init(B);
+    mag_init(epsmax);
+    mag_init(xm);
+    mag_init(u);
+    mag_init(err);
+
+    /* scale = L h / (2 pi), step = 1 / scale, ch = c h */
+    arb_const_pi(scale, prec);
+    arb_mul_2exp_si(scale, scale, 1);
+    arb_div(scale, h, scale, prec);
+    arb_mul_si(scale, scale, L, prec);
+    arb_inv(step, scale, prec);
+    arb_mul_si(ch, h, c, prec);
+
+    for (n = 1; n <= N; n++)
+    {
+        arb_srcptr lam = logn + n - 1;
+
+        arb_mul(t, lam, scale, prec);
+        m = (slong) floor(arf_get_d(arb_midref(t), ARF_RND_NEAR) + 0.5);
+
+        /* eps = log(n) - m / scale */
+        arb_mul_si(eps, step, m, prec);
+        arb_sub(eps, lam, eps, prec);
+
+        /* z = n^(-sigma) e^(-i (t0 log(n) + c h eps)) */
+        arb_mul(phase, t0, lam, prec);
+        arb_addmul(phase, ch, eps, prec);
+        arb_sin_cos(acb_imagref(z), acb_realref(z), phase, prec);
+        arb_neg(acb_imagref(z), acb_imagref(z));
+        arb_mul(t, sigma, lam, prec);
+        arb_neg(t, t);
+        arb_exp(t, t, prec);
+        acb_mul_arb(z, z, t, prec);
+
+        arb_get_mag(u, t);
+        mag_add(B, B, u);
+        arb_get_mag(u, eps);
+        mag_max(epsmax, epsmax, u);
+
+        m = m % L;
+        for (k = 0; k < K; k++)
+        {
+            acb_add(D + k * L + m, D + k * L + m, z, prec);
+            if (k + 1 < K)
+                acb_mul_arb(z, z, eps, prec);
+        }
+    }
+
+    acb_dft_precomp_init(pre, L, prec);
+    acb_dft_precomp_many(D, L, D, L, K, pre, prec);
+    acb_dft_precomp_clear(pre);
+
+    for (j = 0; j < M; j++)
+    {
+        /* y = -i (j - c) h */
+        arb_zero(acb_realref(y));
+        arb_mul_si(acb_imagref(y), h, c - j, prec);
+
+        acb_set(z, D + (K - 1) * L + j);
+        for (k = K - 1; k >= 1; k--)
+        {
+            acb_mul(z, z, y, prec);
+            acb_div_ui(z, z, k, prec);
+            acb_add(z, z, D + (k - 1) * L + j, prec);
+        }
+
+        /* tail bound */
+        arb_get_mag(xm, acb_imagref(y));
+        mag_mul(xm, xm, epsmax);
+        mag_div_ui(u, xm, K + 1);
+        mag_geom_series(u, u, 0);
+        mag_pow_ui(err, xm, K);
+        mag_mul(err, err, u);
+        mag_rfac_ui(u, K);
+        mag_mul(err, err, u);
+        mag_mul(err, err, B);
+
+        acb_add_error_mag(z, err);
+        acb_swap(res + j, z);
+    }
+
+    _acb_vec_clear(D, K * L);
+    acb_clear(z);
+    acb_clear(y);
+    arb_clear(scale);
+    arb_clear(step);
+    arb_clear(ch);
+    arb_clear(eps);
+    arb_clear(phase);
+    arb_clear(t);
+    mag_clear(B);
+    mag_clear(epsmax);
+    mag_clear(xm);
+    mag_clear(u);
+    mag_clear(err);
+}
+
+/* X = pi^(s-1/2) gamma((1-s)/2) rgamma(s/2)
+     = (2 pi)^s rgamma(s) / (2 cos(pi s / 2)), as in zeta_rs_mid */
+static void
+_acb_dirichlet_zeta_rs_X(acb_t X, const acb_t s, slong prec)
+{
+    acb_t t;
+    slong wp;
+
+    acb_init(t);
+
+    wp = prec + 10 + arf_abs_bound_lt_2exp_si(arb_midref(acb_imagref(s)));
+    wp = FLINT_MAX(wp, 10);
+
+    acb_rgamma(X, s, wp);
+    acb_const_pi(t, wp);
+    acb_mul_2exp_si(t, t, 1);
+    acb_pow(t, t, s, wp);
+    acb_mul(X, X, t, wp);
+    acb_mul_2exp_si(t, s, -1);
+    acb_cos_pi(t, t, wp);
+    acb_mul_2exp_si(t, t, 1);
+    acb_div(X, X, t, wp);
+
+    acb_clear(t);
+}
+
+/* u = s + i j h, computed exactly */
+static void
+_acb_dirichlet_zeta_rs_vec_point(acb_t u, const acb_t s, const arb_t h, slong j)
+{
+    arb_t t;
+    arb_init(t);
+    arb_mul_si(t, h, j, ARF_PREC_EXACT);
+    arb_set(acb_realref(u), acb_realref(s));
+    arb_add(acb_imagref(u), acb_imagref(s), t, ARF_PREC_EXACT);
+    arb_clear(t);
+}
+
+typedef struct
+{
+    acb_ptr R1;
+    acb_ptr R2;
+    acb_ptr X;
+    ulong * N;
+    const acb_struct * s;
+    const arb_struct * h;
+    int critical;
+    slong K;
+    slong prec;
+}
+zeta_rs_vec_work_t;
+
+/* remainder terms and the factor X at the point s + i j h */
+static void
+zeta_rs_vec_worker(slong j, zeta_rs_vec_work_t * work)
+{
+    acb_t s, t;
+    ulong N2;
+
+    acb_init(s);
+    acb_init(t);
+
+    _acb_dirichlet_zeta_rs_vec_point(s, work->s, work->h, j);
+
+    _acb_dirichlet_zeta_rs_r(work->R1 + j, work->N + j, s, work->K, 0, work->prec);
+
+    if (work->critical)
+    {
+        acb_conj(work->R2 + j, work->R1 + j);
+    }
+    else
+    {
+        /* conj(R(conj(1-s))) */
+        arb_sub_ui(acb_realref(t), acb_realref(s), 1, ARF_PREC_EXACT);
+        arb_neg(acb_realref(t), acb_realref(t));
+        arb_set(acb_imagref(t), acb_imagref(s));
+        _acb_dirichlet_zeta_rs_r(work->R2 + j, &N2, t, work->K, 0, work->prec);
+        acb_conj(work->R2 + j, work->R2 + j);
+
+        if (N2 != work->N[j])
+            work->N[j] = 0;
+    }
+
+    if (work->N[j] != 0 && acb_is_finite(work->R1 + j) && acb_is_finite(work->R2 + j))
+        _acb_dirichlet_zeta_rs_X(work->X + j, s, work->prec);
+    else
+        work->N[j] = 0;
+
+    acb_clear(s);
+    acb_clear(t);
+}
+
+/* adds sum_{N1 < n <= N2} n^(-sigma - i t) to res */
+static void
+_acb_dirichlet_powsum_range(acb_t res, const arb_t sigma, const arb_t t,
+    arb_srcptr logn, ulong N1, ulong N2, slong prec)
+{
+    acb_t z, u;
+    ulong n;
+
+    acb_init(z);
+    acb_init(u);
+
+    for (n = N1 + 1; n <= N2; n++)
+    {
+        arb_mul(acb_realref(u), sigma, logn + n - 1, prec);
+        arb_mul(acb_imagref(u), t, logn + n - 1, prec);
+        acb_neg(u, u);
+        acb_exp(z, u, prec);
+        acb_add(res, res, z, prec);
+    }
+
+    acb_clear(z);
+    acb_clear(u);
+}
+
+void
+acb_dirichlet_zeta_rs_vec(acb_ptr res, const acb_t s, const arb_t h,
+    slong num, slong K, slong prec)
+{
+    zeta_rs_vec_work_t work;
+    acb_ptr R1, R2, X, S1, S2;
+    arb_ptr logn;
+    arb_t sigma2, t0;
+    acb_t u;
+    ulong * N;
+    ulong Nmin, Nmax, n;
+    slong j, j0, M, wp;
+    int critical;
+
+    if (num <= 0)
+        return;
+
+    if (num < ZETA_RS_VEC_MIN_NUM || !acb_is_exact(s) || !arb_is_exact(h) ||
+        !arb_is_positive(h) || !arb_is_positive(acb_imagref(s)) ||
+        arf_cmpabs_2exp_si(arb_midref(h), 30) > 0)
+    {
+        acb_init(u);
+        for (j = 0; j < num; j++)
+        {
+            _acb_dirichlet_zeta_rs_vec_point(u, s, h, j);
+            acb_dirichlet_zeta_rs(res + j, u, K, prec);
+        }
+        acb_clear(u);
+        return;
+    }
+
+    critical = arb_is_exact(acb_realref(s)) &&
+        (arf_cmp_2exp_si(arb_midref(acb_realref(s)), -1) == 0);
+
+    R1 = _acb_vec_init(num);
+    R2 = _acb_vec_init(num);
+    X = _acb_vec_init(num);
+    N = flint_malloc(sizeof(ulong) * num);
+
+    work.R1 = R1;
+    work.R2 = R2;
+    work.X = X;
+    work.N = N;
+    work.s = s;
+    work.h = h;
+    work.critical = critical;
+    work.K = K;
+    work.prec = prec;
+
+    flint_parallel_do((do_func_t) zeta_rs_vec_worker, &work, num, -1,
+        FLINT_PARALLEL_STRIDED);
+
+    Nmin = UWORD_MAX;
+    Nmax = 0;
+    for (j = 0; j < num; j++)
+    {
+        if (N[j] != 0)
+        {
+            Nmin = FLINT_MIN(Nmin, N[j]);
+            Nmax = FLINT_MAX(Nmax, N[j]);
+        }
+    }
+
+    if (Nmax != 0)
+    {
+        arb_init(sigma2);
+        arb_init(t0);
+        acb_init(u);
+
+        /* the phases t log(n) need about 2 log2(N) extra bits */
+        wp = prec + 20 + 2 * FLINT_BIT_COUNT(Nmax) + FLINT_BIT_COUNT(num);
+
+        logn = _arb_vec_init(Nmax);
+        for (n = 1; n <= Nmax; n++)
+            arb_log_ui(logn + n - 1, n, wp);
+
+        S1 = _acb_vec_init(num);
+        S2 = critical ? S1 : _acb_vec_init(num);
+
+        arb_sub_ui(sigma2, acb_realref(s), 1, ARF_PREC_EXACT);
+        arb_neg(sigma2, sigma2);
+
+        for (j0 = 0; j0 < num; j0 += M)
+        {
+            M = FLINT_MIN(ZETA_RS_VEC_BLOCK, num - j0);
+
+            arb_mul_si(t0, h, j0, ARF_PREC_EXACT);
+            arb_add(t0, t0, acb_imagref(s), ARF_PREC_EXACT);
+
+            _acb_dirichlet_powsum_multieval(S1 + j0, acb_realref(s), t0, h,
+                logn, Nmin, M, wp);
+            if (!critical)
+                _acb_dirichlet_powsum_multieval(S2 + j0, sigma2, t0, h,
+                    logn, Nmin, M, wp);
+        }
+
+        for (j = 0; j < num; j++)
+        {
+            if (N[j] == 0)
+                continue;
+
+            _acb_dirichlet_zeta_rs_vec_point(u, s, h, j);
+
+            /* the main sums may be longer than Nmin at this point */
+            _acb_dirichlet_powsum_range(S1 + j, acb_realref(s), acb_imagref(u), logn, Nmin, N[j], wp);
+            if (!critical)
+                _acb_dirichlet_powsum_range(S2 + j, sigma2, acb_imagref(u), logn, Nmin, N[j], wp);
+
+            /* R1 + X * R2 */
+            acb_add(R1 + j, R1 + j, S1 + j, wp);
+            acb_conj(u, S2 + j);
+            acb_add(R2 + j, R2 + j, u, wp);
+            acb_mul(R2 + j, R2 + j, X + j, wp);
+            acb_add(res + j, R1 + j, R2 + j, prec);
+        }
+
+        _arb_vec_clear(logn, Nmax);
+        _acb_vec_clear(S1, num);
+        if (!critical)
+            _acb_vec_clear(S2, num);
+
+        arb_clear(sigma2);
+        arb_clear(t0);
+        acb_clear(u);
+    }
+
+    /* points where the Riemann-Siegel formula did not apply */
+    acb_init(u);
+    for (j = 0; j < num; j++)
+    {
+        if (N[j] == 0)
+        {
+            _acb_dirichlet_zeta_rs_vec_point(u, s, h, j);
+            acb_dirichlet_zeta_rs(res + j, u, K, prec);
+        }
+    }
+    acb_clear(u);
+
+    _acb_vec_clear(R1, num);
+    _acb_vec_clear(R2, num);
+    _acb_vec_clear(X, num);
+    flint_free(N);
+}
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_mat.h"
 
 static void
@@ -142,42 +143,58 @@ acb_mat_approx_lu_classical(slong * P, acb_mat_t LU, const acb_mat_t A, slong pr
     return result;
 }
 
-int
-acb_mat_approx_lu_recursive(slong * P, acb_mat_t LU, const acb_mat_t A, slong prec)
+static void
+_acb_mat_approx_submul(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
 {
-    slong i, m, n, r1, r2, n1;
-    acb_mat_t A0, A1, A00, A01, A10, A11;
-    slong * P1;
+    acb_mat_t T;
+    acb_mat_init(T, A->r, B->c);
+    acb_mat_approx_mul(T, A, B, prec);
+    acb_mat_sub(C, C, T, prec);
+    acb_mat_get_mid(C, C);
+    acb_mat_clear(T);
+}
 
-    m = A->r;
-    n = A->c;
+/* With lookahead, the trailing update of the right part of A11 is done
+   concurrently with the factorization of the left panel of A11. */
+typedef struct
+{
+    slong * P;
+    acb_mat_struct * A11L;
+    acb_mat_struct * A11R;
+    const acb_mat_struct * A10;
+    const acb_mat_struct * A01R;
+    slong prec;
+    int result;
+}
+_lu_work_t;
 
-    if (m <= 1 || n <= 1)
-    {
-        return acb_mat_approx_lu_classical(P, LU, A, prec);
-    }
+static void
+_lu_worker(slong i, _lu_work_t * work)
+{
+    if (i == 0)
+        work->result = acb_mat_approx_lu(work->P, work->A11L, work->A11L, work->prec);
+    else
+        _acb_mat_approx_submul(work->A11R, work->A10, work->A01R, work->prec);
+}
 
-    acb_mat_get_mid(LU, A);
+/* Completes the factorization of LU, given that the window consisting of
+   the first n1 columns has been factored successfully in place with
+   row permutation P1. */
+static int
+_acb_mat_approx_lu_recursive_tail(slong * P, acb_mat_t LU, slong n1,
+    slong * P1, slong prec)
+{
+    slong i, m, n, r1, n2;
+    acb_mat_t A00, A01, A10, A11;
+    slong * P2;
+    int r2;
 
-    n1 = n / 2;
+    m = LU->r;
+    n = LU->c;
 
     for (i = 0; i < m; i++)
         P[i] = i;
 
-    P1 = flint_malloc(sizeof(slong) * m);
-    acb_mat_window_init(A0, LU, 0, 0, m, n1);
-    acb_mat_window_init(A1, LU, 0, n1, m, n);
-
-    r1 = acb_mat_approx_lu(P1, A0, A0, prec);
-
-    if (!r1)
-    {
-        flint_free(P1);
-        acb_mat_window_clear(A0);
-        acb_mat_window_clear(A1);
-        return 0;
-    }
-
     /* r1 = rank of A0 */
     r1 = FLINT_MIN(m, n1);
 
@@ -190,32 +207,104 @@ acb_mat_approx_lu_recursive(slong * P, acb_mat_t LU, const acb_mat_t A, slong pr
 
     acb_mat_approx_solve_tril(A01, A00, A01, 1, prec);
 
+    P2 = flint_malloc(sizeof(slong) * m);
+
+    /* A11 will be factored recursively (see acb_mat_approx_lu); split
+       it the same way to look ahead. */
+    if (acb_mat_nrows(A11) >= 8 && acb_mat_ncols(A11) >= 8)
     {
-        /* acb_mat_submul(A11, A11, A10, A01, prec); */
-        acb_mat_t T;
-        acb_mat_init(T, A10->r, A01->c);
-        acb_mat_approx_mul(T, A10, A01, prec);
-        acb_mat_sub(A11, A11, T, prec);
-        acb_mat_get_mid(A11, A11);
-        acb_mat_clear(T);
-    }
+        acb_mat_t A01L, A01R, A11L, A11R;
+        _lu_work_t work;
+        slong * Q;
+
+        n2 = A11->c / 2;
+
+        acb_mat_window_init(A01L, LU, 0, n1, r1, n1 + n2);
+        acb_mat_window_init(A01R, LU, 0, n1 + n2, r1, n);
+        acb_mat_window_init(A11L, LU, r1, n1, m, n1 + n2);
+        acb_mat_window_init(A11R, LU, r1, n1 + n2, m, n);
+
+        _acb_mat_approx_submul(A11L, A10, A01L, prec);
 
-    r2 = acb_mat_approx_lu(P1, A11, A11, prec);
+        work.P = P2;
+        work.A11L = A11L;
+        work.A11R = A11R;
+        work.A10 = A10;
+        work.A01R = A01R;
+        work.prec = prec;
 
-    if (!r2)
-        r1 = r2 = 0;
+        flint_parallel_do((do_func_t) _lu_worker, &work, 2, -1, FLINT_PARALLEL_UNIFORM);
+
+        r2 = work.result;
+
+        acb_mat_window_clear(A01L);
+        acb_mat_window_clear(A01R);
+        acb_mat_window_clear(A11L);
+        acb_mat_window_clear(A11R);
+
+        if (r2)
+        {
+            Q = flint_malloc(sizeof(slong) * (m - r1));
+            r2 = _acb_mat_approx_lu_recursive_tail(Q, A11, n2, P2, prec);
+            if (r2)
+                _apply_permutation(P, LU, Q, m - r1, r1);
+            flint_free(Q);
+        }
+    }
     else
-        _apply_permutation(P, LU, P1, m - r1, r1);
+    {
+        _acb_mat_approx_submul(A11, A10, A01, prec);
 
-    flint_free(P1);
+        r2 = acb_mat_approx_lu(P2, A11, A11, prec);
+
+        if (r2)
+            _apply_permutation(P, LU, P2, m - r1, r1);
+    }
+
+    flint_free(P2);
     acb_mat_window_clear(A00);
     acb_mat_window_clear(A01);
     acb_mat_window_clear(A10);
     acb_mat_window_clear(A11);
+
+    return r2;
+}
+
+int
+acb_mat_approx_lu_recursive(slong * P, acb_mat_t LU, const acb_mat_t A, slong prec)
+{
+    slong i, m, n, r1, n1;
+    acb_mat_t A0;
+    slong * P1;
+
+    m = A->r;
+    n = A->c;
+
+    if (m <= 1 || n <= 1)
+    {
+        return acb_mat_approx_lu_classical(P, LU, A, prec);
+    }
+
+    acb_mat_get_mid(LU, A);
+
+    n1 = n / 2;
+
+    for (i = 0; i < m; i++)
+        P[i] = i;
+
+    P1 = flint_malloc(sizeof(slong) * m);
+    acb_mat_window_init(A0, LU, 0, 0, m, n1);
+
+    r1 = acb_mat_approx_lu(P1, A0, A0, prec);
+
     acb_mat_window_clear(A0);
-    acb_mat_window_clear(A1);
 
-    return r1 && r2;
+    if (r1)
+        r1 = _acb_mat_approx_lu_recursive_tail(P, LU, n1, P1, prec);
+
+    flint_free(P1);
+
+    return r1;
 }
 
 int
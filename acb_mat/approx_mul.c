@@ -11,6 +11,8 @@
 
 #include "acb_mat.h"
 
+#define APPROX_MUL_DOUBLE_CUTOFF 4
+
 void
 acb_mat_approx_mul_classical(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
 {
@@ -89,6 +91,15 @@ acb_mat_approx_mul(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec
 {
     slong cutoff;
 
+    /* use hardware floating-point arithmetic at low precision */
+    if (prec <= 106 && acb_mat_nrows(A) >= APPROX_MUL_DOUBLE_CUTOFF &&
+        acb_mat_ncols(A) >= APPROX_MUL_DOUBLE_CUTOFF &&
+        acb_mat_ncols(B) >= APPROX_MUL_DOUBLE_CUTOFF &&
+        acb_mat_approx_mul_double(C, A, B, prec))
+    {
+        return;
+    }
+
     /* todo: detect small-integer matrices */
     if (prec <= 2 * FLINT_BITS)
         cutoff = 120;
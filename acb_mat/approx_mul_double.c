@@ -0,0 +1,200 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_mat.h"
+
+/* updates the max and min exponents with those of the midpoint of z */
+static int
+_acb_update_exp(slong * emax, slong * emin, const acb_t z)
+{
+    return _arb_mat_approx_d_update_exp(emax, emin, arb_midref(acb_realref(z)))
+        && _arb_mat_approx_d_update_exp(emax, emin, arb_midref(acb_imagref(z)));
+}
+
+int
+acb_mat_approx_mul_double(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
+{
+    slong ar, ac, bc, i, j, emin, nA, nB, nC;
+    slong *ea, *eb;
+    double *Arh, *Arl, *Aih, *Ail, *Anh, *Anl;
+    double *Brh, *Brl, *Bih, *Bil;
+    double *Crh, *Crl, *Cih, *Cil;
+    double * tmp;
+    int dd, success;
+    arf_t t, u;
+
+    ar = acb_mat_nrows(A);
+    ac = acb_mat_ncols(A);
+    bc = acb_mat_ncols(B);
+
+    if (prec > 106)
+        return 0;
+
+    dd = (prec > 53);
+
+    if (ac == 0)
+    {
+        acb_mat_zero(C);
+        return 1;
+    }
+
+    if (ar == 0 || bc == 0)
+        return 1;
+
+    ea = flint_malloc(sizeof(slong) * (ar + bc));
+    eb = ea + ar;
+
+    success = 1;
+
+    for (i = 0; i < ar && success; i++)
+    {
+        ea[i] = WORD_MIN;
+        emin = WORD_MAX;
+
+        for (j = 0; j < ac && success; j++)
+            success = _acb_update_exp(ea + i, &emin, acb_mat_entry(A, i, j));
+
+        if (ea[i] != WORD_MIN && ea[i] - emin > ARB_MAT_APPROX_D_MAX_SPREAD)
+            success = 0;
+    }
+
+    for (j = 0; j < bc && success; j++)
+    {
+        eb[j] = WORD_MIN;
+        emin = WORD_MAX;
+
+        for (i = 0; i < ac && success; i++)
+            success = _acb_update_exp(eb + j, &emin, acb_mat_entry(B, i, j));
+
+        if (eb[j] != WORD_MIN && eb[j] - emin > ARB_MAT_APPROX_D_MAX_SPREAD)
+            success = 0;
+    }
+
+    if (!success)
+    {
+        flint_free(ea);
+        return 0;
+    }
+
+    nA = ar * ac;
+    nB = ac * bc;
+    nC = ar * bc;
+
+    tmp = flint_malloc(sizeof(double) * (dd ? 2 : 1) * (3 * nA + 2 * nB + 2 * nC));
+
+    Arh = tmp;
+    Aih = Arh + nA;
+    Anh = Aih + nA;
+    Brh = Anh + nA;
+    Bih = Brh + nB;
+    Crh = Bih + nB;
+    Cih = Crh + nC;
+
+    Arl = Ail = Anl = Brl = Bil = Crl = Cil = NULL;
+
+    if (dd)
+    {
+        Arl = Cih + nC;
+        Ail = Arl + nA;
+        Anl = Ail + nA;
+        Brl = Anl + nA;
+        Bil = Brl + nB;
+        Crl = Bil + nB;
+        Cil = Crl + nC;
+    }
+
+    arf_init(t);
+    arf_init(u);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < ac; j++)
+        {
+            slong k = i * ac + j;
+
+            _arb_mat_approx_d_get(Arh + k, dd ? Arl + k : NULL,
+                arb_midref(acb_realref(acb_mat_entry(A, i, j))), ea[i], t, u);
+            _arb_mat_approx_d_get(Aih + k, dd ? Ail + k : NULL,
+                arb_midref(acb_imagref(acb_mat_entry(A, i, j))), ea[i], t, u);
+
+            Anh[k] = -Aih[k];
+            if (dd)
+                Anl[k] = -Ail[k];
+        }
+    }
+
+    for (i = 0; i < ac; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            slong k = i * bc + j;
+
+            _arb_mat_approx_d_get(Brh + k, dd ? Brl + k : NULL,
+                arb_midref(acb_realref(acb_mat_entry(B, i, j))), eb[j], t, u);
+            _arb_mat_approx_d_get(Bih + k, dd ? Bil + k : NULL,
+                arb_midref(acb_imagref(acb_mat_entry(B, i, j))), eb[j], t, u);
+        }
+    }
+
+    for (i = 0; i < nC; i++)
+    {
+        Crh[i] = Cih[i] = 0.0;
+        if (dd)
+            Crl[i] = Cil[i] = 0.0;
+    }
+
+    /* (Ar + i Ai)(Br + i Bi) = (Ar Br - Ai Bi) + i (Ar Bi + Ai Br) */
+    if (dd)
+    {
+        success = _arb_mat_approx_gemm_dd(Crh, Crl, Arh, Arl, Brh, Brl, ar, ac, bc)
+               && _arb_mat_approx_gemm_dd(Crh, Crl, Anh, Anl, Bih, Bil, ar, ac, bc)
+               && _arb_mat_approx_gemm_dd(Cih, Cil, Arh, Arl, Bih, Bil, ar, ac, bc)
+               && _arb_mat_approx_gemm_dd(Cih, Cil, Aih, Ail, Brh, Brl, ar, ac, bc);
+    }
+    else
+    {
+        _arb_mat_approx_gemm_d(Crh, Arh, Brh, ar, ac, bc);
+        _arb_mat_approx_gemm_d(Crh, Anh, Bih, ar, ac, bc);
+        _arb_mat_approx_gemm_d(Cih, Arh, Bih, ar, ac, bc);
+        _arb_mat_approx_gemm_d(Cih, Aih, Brh, ar, ac, bc);
+    }
+
+    if (success)
+    {
+        for (i = 0; i < ar; i++)
+        {
+            for (j = 0; j < bc; j++)
+            {
+                acb_ptr c = acb_mat_entry(C, i, j);
+                slong k = i * bc + j;
+
+                if (ea[i] == WORD_MIN || eb[j] == WORD_MIN)
+                {
+                    arf_zero(arb_midref(acb_realref(c)));
+                    arf_zero(arb_midref(acb_imagref(c)));
+                    continue;
+                }
+
+                _arb_mat_approx_d_set(arb_midref(acb_realref(c)), Crh + k,
+                    dd ? Crl + k : NULL, ea[i] + eb[j], t, u, prec);
+                _arb_mat_approx_d_set(arb_midref(acb_imagref(c)), Cih + k,
+                    dd ? Cil + k : NULL, ea[i] + eb[j], t, u, prec);
+            }
+        }
+    }
+
+    arf_clear(t);
+    arf_clear(u);
+    flint_free(tmp);
+    flint_free(ea);
+
+    return success;
+}
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_mat.h"
 
 static void
@@ -44,6 +45,86 @@ clear_shallow(arb_mat_t X)
             arb_init(arb_mat_entry(X, i, j));
 }
 
+typedef struct
+{
+    arb_mat_struct * Z;
+    const arb_mat_struct * X;
+    const arb_mat_struct * Y;
+    slong prec;
+}
+mul_work_t;
+
+static void
+mul_worker(slong i, mul_work_t * work)
+{
+    arb_mat_mul(work[i].Z, work[i].X, work[i].Y, work[i].prec);
+}
+
+/* Computes the four real products reA*reB, imA*imB, reA*imB, imA*reB
+   simultaneously; each product may use further threads internally. */
+static void
+acb_mat_mul_reorder_parallel(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
+{
+    arb_mat_t Ar, Ai, Br, Bi;
+    arb_mat_struct Z[4];
+    mul_work_t work[4];
+    slong M, N, P;
+    slong i, j;
+
+    M = acb_mat_nrows(A);
+    N = acb_mat_ncols(A);
+    P = acb_mat_ncols(B);
+
+    arb_mat_init(Ar, M, N);
+    arb_mat_init(Ai, M, N);
+    arb_mat_init(Br, N, P);
+    arb_mat_init(Bi, N, P);
+
+    copy_re_shallow(Ar, A);
+    copy_im_shallow(Ai, A);
+    copy_re_shallow(Br, B);
+    copy_im_shallow(Bi, B);
+
+    for (i = 0; i < 4; i++)
+    {
+        arb_mat_init(Z + i, M, P);
+        work[i].Z = Z + i;
+        work[i].prec = prec;
+    }
+
+    work[0].X = Ar; work[0].Y = Br;
+    work[1].X = Ai; work[1].Y = Bi;
+    work[2].X = Ar; work[2].Y = Bi;
+    work[3].X = Ai; work[3].Y = Br;
+
+    flint_parallel_do((do_func_t) mul_worker, work, 4, -1, FLINT_PARALLEL_DYNAMIC);
+
+    clear_shallow(Ar);
+    clear_shallow(Ai);
+    clear_shallow(Br);
+    clear_shallow(Bi);
+
+    /* A and B are no longer needed, so C may alias them */
+    for (i = 0; i < M; i++)
+    {
+        for (j = 0; j < P; j++)
+        {
+            arb_sub(acb_realref(acb_mat_entry(C, i, j)),
+                arb_mat_entry(Z + 0, i, j), arb_mat_entry(Z + 1, i, j), prec);
+            arb_add(acb_imagref(acb_mat_entry(C, i, j)),
+                arb_mat_entry(Z + 2, i, j), arb_mat_entry(Z + 3, i, j), prec);
+        }
+    }
+
+    arb_mat_clear(Ar);
+    arb_mat_clear(Ai);
+    arb_mat_clear(Br);
+    arb_mat_clear(Bi);
+
+    for (i = 0; i < 4; i++)
+        arb_mat_clear(Z + i);
+}
+
 /* todo: squaring optimizations */
 void
 acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
@@ -213,6 +294,10 @@ acb_mat_mul_reorder(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pre
         arb_mat_clear(Y);
         arb_mat_clear(Z);
     }
+    else if (flint_get_num_threads() > 1)
+    {
+        acb_mat_mul_reorder_parallel(C, A, B, prec);
+    }
     else
     {
         arb_mat_init(X, M, N);
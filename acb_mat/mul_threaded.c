@@ -9,61 +9,79 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_mat.h"
-#include "pthread.h"
+
+/* Below this amount of work (roughly the number of limb operations),
+   thread overhead is not worth it. */
+#define MUL_THREADED_MIN_WORK 100000.0
 
 typedef struct
 {
     acb_ptr * C;
     const acb_ptr * A;
     const acb_ptr * B;
-    slong ar0;
-    slong ar1;
-    slong bc0;
-    slong bc1;
+    slong ar;
     slong br;
+    slong bc;
+    slong num_tasks;
     slong prec;
 }
-acb_mat_mul_arg_t;
+acb_mat_mul_work_t;
 
-void *
-_acb_mat_mul_thread(void * arg_ptr)
+static void
+_acb_mat_mul_worker(slong k, acb_mat_mul_work_t * work)
 {
-    acb_mat_mul_arg_t arg = *((acb_mat_mul_arg_t *) arg_ptr);
-    slong i, j, br, bc;
+    slong i, j, br, bc, ar0, ar1, bc0, bc1;
     acb_ptr tmp;
     TMP_INIT;
 
-    br = arg.br;
-    bc = arg.bc1 - arg.bc0;
+    /* split the larger dimension of C */
+    if (work->ar >= work->bc)
+    {
+        ar0 = (work->ar * k) / work->num_tasks;
+        ar1 = (work->ar * (k + 1)) / work->num_tasks;
+        bc0 = 0;
+        bc1 = work->bc;
+    }
+    else
+    {
+        ar0 = 0;
+        ar1 = work->ar;
+        bc0 = (work->bc * k) / work->num_tasks;
+        bc1 = (work->bc * (k + 1)) / work->num_tasks;
+    }
+
+    br = work->br;
+    bc = bc1 - bc0;
+
+    if (ar1 == ar0 || bc == 0)
+        return;
 
     TMP_START;
     tmp = TMP_ALLOC(sizeof(acb_struct) * br * bc);
 
     for (i = 0; i < br; i++)
         for (j = 0; j < bc; j++)
-            tmp[j * br + i] = arg.B[i][arg.bc0 + j];
+            tmp[j * br + i] = work->B[i][bc0 + j];
 
-    for (i = arg.ar0; i < arg.ar1; i++)
+    for (i = ar0; i < ar1; i++)
     {
-        for (j = arg.bc0; j < arg.bc1; j++)
+        for (j = bc0; j < bc1; j++)
         {
-            acb_dot(arg.C[i] + j, NULL, 0,
-                arg.A[i], 1, tmp + (j - arg.bc0) * br, 1, br, arg.prec);
+            acb_dot(work->C[i] + j, NULL, 0,
+                work->A[i], 1, tmp + (j - bc0) * br, 1, br, work->prec);
         }
     }
 
     TMP_END;
-    flint_cleanup();
-    return NULL;
 }
 
 void
 acb_mat_mul_threaded(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
 {
-    slong ar, ac, br, bc, i, num_threads;
-    pthread_t * threads;
-    acb_mat_mul_arg_t * args;
+    slong ar, ac, br, bc, num_threads;
+    acb_mat_mul_work_t work;
 
     ar = acb_mat_nrows(A);
     ac = acb_mat_ncols(A);
@@ -82,6 +100,15 @@ acb_mat_mul_threaded(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pr
         return;
     }
 
+    num_threads = flint_get_num_threads();
+
+    if (num_threads <= 1 || FLINT_MAX(ar, bc) <= 1 ||
+        (double) ar * br * bc * (1 + prec / FLINT_BITS) < MUL_THREADED_MIN_WORK)
+    {
+        acb_mat_mul_classical(C, A, B, prec);
+        return;
+    }
+
     if (A == C || B == C)
     {
         acb_mat_t T;
@@ -92,42 +119,15 @@ acb_mat_mul_threaded(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong pr
         return;
     }
 
-    num_threads = flint_get_num_threads();
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
-    args = flint_malloc(sizeof(acb_mat_mul_arg_t) * num_threads);
-
-    for (i = 0; i < num_threads; i++)
-    {
-        args[i].C = C->rows;
-        args[i].A = A->rows;
-        args[i].B = B->rows;
-
-        if (ar >= bc)
-        {
-            args[i].ar0 = (ar * i) / num_threads;
-            args[i].ar1 = (ar * (i + 1)) / num_threads;
-            args[i].bc0 = 0;
-            args[i].bc1 = bc;
-        }
-        else
-        {
-            args[i].ar0 = 0;
-            args[i].ar1 = ar;
-            args[i].bc0 = (bc * i) / num_threads;
-            args[i].bc1 = (bc * (i + 1)) / num_threads;
-        }
-
-        args[i].br = br;
-        args[i].prec = prec;
-
-        pthread_create(&threads[i], NULL, _acb_mat_mul_thread, &args[i]);
-    }
-
-    for (i = 0; i < num_threads; i++)
-    {
-        pthread_join(threads[i], NULL);
-    }
-
-    flint_free(threads);
-    flint_free(args);
+    work.C = C->rows;
+    work.A = A->rows;
+    work.B = B->rows;
+    work.ar = ar;
+    work.br = br;
+    work.bc = bc;
+    work.num_tasks = FLINT_MIN(num_threads, FLINT_MAX(ar, bc));
+    work.prec = prec;
+
+    flint_parallel_do((do_func_t) _acb_mat_mul_worker, &work,
+        work.num_tasks, -1, FLINT_PARALLEL_UNIFORM);
 }
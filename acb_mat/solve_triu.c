@@ -9,23 +9,24 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_mat.h"
 
-void
-acb_mat_solve_triu_classical(acb_mat_t X, const acb_mat_t U,
-    const acb_mat_t B, int unit, slong prec)
+static void
+_acb_mat_solve_triu_classical(acb_mat_t X, const acb_mat_t U,
+    const acb_mat_t B, int unit,
+    slong col_start, slong col_end, slong prec)
 {
-    slong i, j, n, m;
+    slong i, j, n;
     acb_ptr tmp;
     acb_t s;
 
     n = U->r;
-    m = B->c;
 
     acb_init(s);
     tmp = flint_malloc(sizeof(acb_struct) * n);
 
-    for (i = 0; i < m; i++)
+    for (i = col_start; i < col_end; i++)
     {
         for (j = 0; j < n; j++)
             tmp[j] = *acb_mat_entry(X, j, i);
@@ -48,6 +49,62 @@ acb_mat_solve_triu_classical(acb_mat_t X, const acb_mat_t U,
     acb_clear(s);
 }
 
+typedef struct
+{
+    acb_mat_struct * X;
+    const acb_mat_struct * U;
+    const acb_mat_struct * B;
+    int unit;
+    slong chunk;
+    slong prec;
+}
+_acb_mat_solve_triu_classical_work_t;
+
+static void
+_acb_mat_solve_triu_classical_worker(slong i, _acb_mat_solve_triu_classical_work_t * work)
+{
+    slong m = acb_mat_ncols(work->B);
+
+    _acb_mat_solve_triu_classical(work->X, work->U, work->B, work->unit,
+        i * work->chunk, FLINT_MIN((i + 1) * work->chunk, m), work->prec);
+}
+
+void
+acb_mat_solve_triu_classical(acb_mat_t X, const acb_mat_t U,
+    const acb_mat_t B, int unit, slong prec)
+{
+    slong n, m, num_threads;
+
+    n = U->r;
+    m = B->c;
+    num_threads = flint_get_num_threads();
+
+    /* the columns are independent */
+    if (num_threads > 1 && m > 1 && (double) n * n * m * prec > 1e6)
+    {
+        _acb_mat_solve_triu_classical_work_t work;
+        slong num_chunks;
+
+        num_chunks = FLINT_MIN(m, 4 * num_threads);
+
+        work.X = X;
+        work.U = U;
+        work.B = B;
+        work.unit = unit;
+        work.chunk = (m + num_chunks - 1) / num_chunks;
+        work.prec = prec;
+
+        num_chunks = (m + work.chunk - 1) / work.chunk;
+
+        flint_parallel_do((do_func_t) _acb_mat_solve_triu_classical_worker, &work,
+            num_chunks, -1, FLINT_PARALLEL_DYNAMIC);
+    }
+    else
+    {
+        _acb_mat_solve_triu_classical(X, U, B, unit, 0, m, prec);
+    }
+}
+
 void
 acb_mat_solve_triu_recursive(acb_mat_t X,
         const acb_mat_t U, const acb_mat_t B, int unit, slong prec)
@@ -0,0 +1,133 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_mat.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("approx_mul_double....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000 * arb_test_multiplier(); iter++)
+    {
+        acb_mat_t A, B, C;
+        acb_t s, t, u;
+        arb_t a, b, err;
+        slong m, n, p, i, j, k, prec, shift;
+        int success;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        p = n_randint(state, 30);
+        prec = 2 + n_randint(state, 130);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        acb_mat_init(A, m, n);
+        acb_mat_init(B, n, p);
+        acb_mat_init(C, m, p);
+        acb_init(s);
+        acb_init(t);
+        acb_init(u);
+        arb_init(a);
+        arb_init(b);
+        arb_init(err);
+
+        acb_mat_randtest(A, state, 2 + n_randint(state, 200), 5);
+        acb_mat_randtest(B, state, 2 + n_randint(state, 200), 5);
+        acb_mat_randtest(C, state, 2 + n_randint(state, 200), 5);
+
+        /* rows and columns of very different magnitude */
+        for (i = 0; i < m; i++)
+        {
+            shift = n_randint(state, 2) ? 0 : (slong) n_randint(state, 1000000) - 500000;
+            for (k = 0; k < n; k++)
+                acb_mul_2exp_si(acb_mat_entry(A, i, k), acb_mat_entry(A, i, k), shift);
+        }
+
+        for (j = 0; j < p; j++)
+        {
+            shift = n_randint(state, 2) ? 0 : (slong) n_randint(state, 1000000) - 500000;
+            for (k = 0; k < n; k++)
+                acb_mul_2exp_si(acb_mat_entry(B, k, j), acb_mat_entry(B, k, j), shift);
+        }
+
+        success = acb_mat_approx_mul_double(C, A, B, prec);
+
+        if (success != (prec <= 106))
+        {
+            flint_printf("FAIL (success)\n\n");
+            flint_printf("prec = %wd, success = %d\n\n", prec, success);
+            flint_abort();
+        }
+
+        for (i = 0; i < m && success; i++)
+        {
+            for (j = 0; j < p; j++)
+            {
+                /* s = exact product, err = bound for the sum of
+                   absolute values */
+                acb_zero(s);
+                arb_zero(err);
+
+                for (k = 0; k < n; k++)
+                {
+                    acb_get_mid(t, acb_mat_entry(A, i, k));
+                    acb_get_mid(u, acb_mat_entry(B, k, j));
+                    acb_abs(a, t, 30);
+                    acb_abs(b, u, 30);
+                    arb_addmul(err, a, b, 30);
+                    acb_mul(t, t, u, ARF_PREC_EXACT);
+                    acb_add(s, s, t, ARF_PREC_EXACT);
+                }
+
+                arb_mul_si(err, err, n + 2, 30);
+                arb_mul_2exp_si(err, err, 3 - prec);
+                arb_add_error(acb_realref(s), err);
+                arb_add_error(acb_imagref(s), err);
+                acb_get_mid(t, acb_mat_entry(C, i, j));
+
+                if (!acb_contains(s, t))
+                {
+                    flint_printf("FAIL (accuracy)\n\n");
+                    flint_printf("m = %wd, n = %wd, p = %wd, prec = %wd, i = %wd, j = %wd\n\n",
+                        m, n, p, prec, i, j);
+                    flint_printf("A = "); acb_mat_printd(A, 30); flint_printf("\n\n");
+                    flint_printf("B = "); acb_mat_printd(B, 30); flint_printf("\n\n");
+                    flint_printf("C = "); acb_mat_printd(C, 30); flint_printf("\n\n");
+                    flint_printf("s = "); acb_printd(s, 30); flint_printf("\n\n");
+                    flint_abort();
+                }
+            }
+        }
+
+        acb_mat_clear(A);
+        acb_mat_clear(B);
+        acb_mat_clear(C);
+        acb_clear(s);
+        acb_clear(t);
+        acb_clear(u);
+        arb_clear(a);
+        arb_clear(b);
+        arb_clear(err);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -48,6 +48,8 @@ int main()
         rbits2 = 2 + n_randint(state, 200);
         rbits3 = 2 + n_randint(state, 200);
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         m = n_randint(state, 8);
         n = n_randint(state, 8);
         k = n_randint(state, 8);
@@ -129,6 +131,7 @@ int main()
         acb_mat_t a, b, c, d;
 
         rbits = 2 + n_randint(state, 200);
+        flint_set_num_threads(1 + n_randint(state, 3));
 
         m = n_randint(state, 8);
         n = n_randint(state, 8);
@@ -366,6 +369,7 @@ int main()
         acb_mat_clear(s);
     }
 
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
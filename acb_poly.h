@@ -429,6 +429,13 @@ void acb_poly_compose_series_horner(acb_poly_t res,
                     const acb_poly_t poly1,
                     const acb_poly_t poly2, slong n, slong prec);
 
+void _acb_poly_compose_series_kinoshita_li(acb_ptr res, acb_srcptr poly1, slong len1,
+                            acb_srcptr poly2, slong len2, slong n, slong prec);
+
+void acb_poly_compose_series_kinoshita_li(acb_poly_t res,
+                    const acb_poly_t poly1,
+                    const acb_poly_t poly2, slong n, slong prec);
+
 void _acb_poly_compose_series_brent_kung(acb_ptr res, acb_srcptr poly1, slong len1,
                             acb_srcptr poly2, slong len2, slong n, slong prec);
 
@@ -463,6 +470,10 @@ void
 _acb_poly_evaluate_vec_fast_precomp(acb_ptr vs, acb_srcptr poly,
     slong plen, acb_ptr * tree, slong len, slong prec);
 
+void
+_acb_poly_evaluate_vec_fast_precomp_inv(acb_ptr vs, acb_srcptr poly,
+    slong plen, acb_ptr * tree, acb_ptr * inv, slong len, slong prec);
+
 void _acb_poly_evaluate_vec_fast(acb_ptr ys, acb_srcptr poly, slong plen,
     acb_srcptr xs, slong n, slong prec);
 
@@ -524,6 +535,39 @@ void _acb_poly_tree_free(acb_ptr * tree, slong len);
 void
 _acb_poly_tree_build(acb_ptr * tree, acb_srcptr roots, slong len, slong prec);
 
+typedef struct
+{
+    acb_ptr * tree;
+    acb_ptr * inv;
+    acb_ptr weights;
+    slong len;
+}
+acb_poly_tree_struct;
+
+typedef acb_poly_tree_struct acb_poly_tree_t[1];
+
+acb_ptr * _acb_poly_tree_inverses_alloc(slong len);
+
+void _acb_poly_tree_inverses_free(acb_ptr * inv, slong len);
+
+void _acb_poly_tree_inverses(acb_ptr * inv, acb_ptr * tree, slong len, slong prec);
+
+void acb_poly_tree_init(acb_poly_tree_t T, acb_srcptr xs, slong len, slong prec);
+
+void acb_poly_tree_clear(acb_poly_tree_t T);
+
+void _acb_poly_tree_evaluate_vec(acb_ptr ys, acb_srcptr poly, slong plen,
+    const acb_poly_tree_t T, slong prec);
+
+void acb_poly_tree_evaluate_vec(acb_ptr ys, const acb_poly_t poly,
+    const acb_poly_tree_t T, slong prec);
+
+void _acb_poly_tree_interpolate(acb_ptr poly, acb_srcptr ys,
+    const acb_poly_tree_t T, slong prec);
+
+void acb_poly_tree_interpolate(acb_poly_t poly, acb_srcptr ys,
+    const acb_poly_tree_t T, slong prec);
+
 
 void _acb_poly_root_inclusion(acb_t r, const acb_t m,
     acb_srcptr poly,
@@ -532,9 +576,15 @@ void _acb_poly_root_inclusion(acb_t r, const acb_t m,
 slong _acb_poly_validate_roots(acb_ptr roots,
         acb_srcptr poly, slong len, slong prec);
 
+void _acb_poly_evaluate_mid(acb_t res, acb_srcptr f, slong len,
+        const acb_t a, slong prec);
+
 void _acb_poly_refine_roots_durand_kerner(acb_ptr roots,
         acb_srcptr poly, slong len, slong prec);
 
+slong _acb_poly_refine_roots_aberth(acb_ptr roots, acb_srcptr poly,
+        acb_srcptr deriv, slong len, int * converged, slong prec);
+
 slong _acb_poly_find_roots(acb_ptr roots,
     acb_srcptr poly,
     acb_srcptr initial, slong len, slong maxiter, slong prec);
@@ -11,6 +11,11 @@
 
 #include "acb_poly.h"
 
+/* use the Kinoshita-Li algorithm when the output and both inputs
+   are at least this long (see arb_poly/profile/p-compose_series.c) */
+#define KINOSHITA_LI_CUTOFF_N 1000
+#define KINOSHITA_LI_CUTOFF_LEN 64
+
 void
 _acb_poly_compose_series(acb_ptr res, acb_srcptr poly1, slong len1,
                             acb_srcptr poly2, slong len2, slong n, slong prec)
@@ -48,10 +53,15 @@ _acb_poly_compose_series(acb_ptr res, acb_srcptr poly1, slong len1,
     {
         _acb_poly_compose_series_horner(res, poly1, len1, poly2, len2, n, prec);
     }
-    else
+    else if (n < KINOSHITA_LI_CUTOFF_N || len1 < KINOSHITA_LI_CUTOFF_LEN
+                || len2 < KINOSHITA_LI_CUTOFF_LEN)
     {
         _acb_poly_compose_series_brent_kung(res, poly1, len1, poly2, len2, n, prec);
     }
+    else
+    {
+        _acb_poly_compose_series_kinoshita_li(res, poly1, len1, poly2, len2, n, prec);
+    }
 }
 
 void
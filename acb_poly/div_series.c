@@ -65,10 +65,14 @@ _acb_poly_div_series(acb_ptr Q, acb_srcptr A, slong Alen,
     else
     {
         acb_ptr Binv;
-        Binv = _acb_vec_init(n);
+        arb_arena_struct * arena;
+
+        arena = _arb_arena_thread();
+        arb_arena_push(arena);
+        Binv = _acb_arena_vec_init(arena, n);
         _acb_poly_inv_series(Binv, B, Blen, n, prec);
         _acb_poly_mullow(Q, Binv, n, A, Alen, n, prec);
-        _acb_vec_clear(Binv, n);
+        arb_arena_pop(arena);
     }
 }
 
@@ -9,32 +9,106 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_poly.h"
 
-/* This gives some speedup for small lengths. */
-static __inline__ void
-_acb_poly_rem_2(acb_ptr r, acb_srcptr a, slong al,
-    acb_srcptr b, slong bl, slong prec)
+/* Remainder of {A, lenA} modulo the monic {B, lenB}, given the inverse
+   of the reversal of B as a power series to length at least the
+   length of the quotient. */
+static void
+_acb_poly_rem_inv(acb_ptr R, acb_srcptr A, slong lenA,
+    acb_srcptr B, slong lenB, acb_srcptr Binv, slong prec)
 {
-    if (al == 2)
+    slong lenQ = lenA - lenB + 1, lenT = FLINT_MAX(lenQ, lenB - 1);
+    acb_ptr Q, T;
+
+    Q = _acb_vec_init(lenQ + lenT);
+    T = Q + lenQ;
+
+    _acb_poly_reverse(Q, A + lenB - 1, lenQ, lenQ);
+    _acb_poly_mullow(T, Q, lenQ, Binv, lenQ, lenQ, prec);
+    _acb_poly_reverse(Q, T, lenQ, lenQ);
+
+    if (lenQ >= lenB - 1)
+        _acb_poly_mullow(T, Q, lenQ, B, lenB - 1, lenB - 1, prec);
+    else
+        _acb_poly_mullow(T, B, lenB - 1, Q, lenQ, lenB - 1, prec);
+
+    _acb_vec_sub(R, A, T, lenB - 1, prec);
+
+    _acb_vec_clear(Q, lenQ + lenT);
+}
+
+/* remainder modulo the node of length bl at level pow, using its
+   precomputed inverse if there is one */
+static void
+_acb_poly_rem_node(acb_ptr r, acb_srcptr a, slong al,
+    acb_srcptr b, slong bl, acb_srcptr binv, slong pow, slong prec)
+{
+    if (al == 2 && bl == 2)
     {
         acb_mul(r + 0, a + 1, b + 0, prec);
         acb_sub(r + 0, a + 0, r + 0, prec);
     }
+    else if (binv != NULL && al - bl + 1 <= pow && bl > 1)
+    {
+        _acb_poly_rem_inv(r, a, al, b, bl, binv, prec);
+    }
     else
     {
         _acb_poly_rem(r, a, al, b, bl, prec);
     }
 }
 
+typedef struct
+{
+    acb_ptr pc;
+    acb_srcptr pb;
+    acb_srcptr pa;
+    acb_srcptr pinv;
+    slong pow;
+    slong len;
+    slong prec;
+}
+_descent_work_t;
+
+/* reduces the k-th block of length 2 pow modulo the two nodes below it */
+static void
+_descent_worker(slong k, _descent_work_t * w)
+{
+    slong pow = w->pow, left;
+    acb_srcptr pa = w->pa + k * (2 * pow + 2);
+    acb_srcptr pb = w->pb + k * 2 * pow;
+    acb_ptr pc = w->pc + k * 2 * pow;
+    acb_srcptr i1, i2;
+
+    left = w->len - k * 2 * pow;
+    i1 = (w->pinv == NULL) ? NULL : w->pinv + 2 * k * pow;
+    i2 = (w->pinv == NULL) ? NULL : w->pinv + (2 * k + 1) * pow;
+
+    if (left >= 2 * pow)
+    {
+        _acb_poly_rem_node(pc, pb, 2 * pow, pa, pow + 1, i1, pow, w->prec);
+        _acb_poly_rem_node(pc + pow, pb, 2 * pow, pa + pow + 1, pow + 1, i2, pow, w->prec);
+    }
+    else if (left > pow)
+    {
+        _acb_poly_rem_node(pc, pb, left, pa, pow + 1, i1, pow, w->prec);
+        _acb_poly_rem_node(pc + pow, pb, left, pa + pow + 1, left - pow + 1, i2, pow, w->prec);
+    }
+    else if (left > 0)
+        _acb_vec_set(pc, pb, left);
+}
+
 void
-_acb_poly_evaluate_vec_fast_precomp(acb_ptr vs, acb_srcptr poly,
-    slong plen, acb_ptr * tree, slong len, slong prec)
+_acb_poly_evaluate_vec_fast_precomp_inv(acb_ptr vs, acb_srcptr poly,
+    slong plen, acb_ptr * tree, acb_ptr * inv, slong len, slong prec)
 {
-    slong height, i, j, pow, left;
+    slong height, i, j, pow, tlen;
     slong tree_height;
-    slong tlen;
-    acb_ptr t, u, swap, pa, pb, pc;
+    acb_ptr t, u, swap;
+    _descent_work_t work;
+    int threaded;
 
     /* avoid worrying about some degenerate cases */
     if (len < 2 || plen < 2)
@@ -62,8 +136,6 @@ _acb_poly_evaluate_vec_fast_precomp(acb_ptr vs, acb_srcptr poly,
     t = _acb_vec_init(len);
     u = _acb_vec_init(len);
 
-    left = len;
-
     /* Initial reduction. We allow the polynomial to be larger
         or smaller than the number of points. */
     height = FLINT_BIT_COUNT(plen - 1) - 1;
@@ -75,35 +147,35 @@ _acb_poly_evaluate_vec_fast_precomp(acb_ptr vs, acb_srcptr poly,
     for (i = j = 0; i < len; i += pow, j += (pow + 1))
     {
         tlen = ((i + pow) <= len) ? pow : len % pow;
-        _acb_poly_rem(t + i, poly, plen, tree[height] + j, tlen + 1, prec);
+        _acb_poly_rem_node(t + i, poly, plen, tree[height] + j, tlen + 1,
+            (inv == NULL || height == 0) ? NULL : inv[height] + i, pow, prec);
     }
 
+    /* the blocks of each level are independent */
+    threaded = (len >= 64 && flint_get_num_threads() > 1);
+
     for (i = height - 1; i >= 0; i--)
     {
         pow = WORD(1) << i;
-        left = len;
-        pa = tree[i];
-        pb = t;
-        pc = u;
 
-        while (left >= 2 * pow)
-        {
-            _acb_poly_rem_2(pc, pb, 2 * pow, pa, pow + 1, prec);
-            _acb_poly_rem_2(pc + pow, pb, 2 * pow, pa + pow + 1, pow + 1, prec);
+        work.pc = u;
+        work.pb = t;
+        work.pa = tree[i];
+        work.pinv = (inv == NULL || i == 0) ? NULL : inv[i];
+        work.pow = pow;
+        work.len = len;
+        work.prec = prec;
 
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
-            pc += 2 * pow;
-            left -= 2 * pow;
+        if (threaded)
+        {
+            flint_parallel_do((do_func_t) _descent_worker, &work,
+                (len + 2 * pow - 1) / (2 * pow), -1, FLINT_PARALLEL_UNIFORM);
         }
-
-        if (left > pow)
+        else
         {
-            _acb_poly_rem(pc, pb, left, pa, pow + 1, prec);
-            _acb_poly_rem(pc + pow, pb, left, pa + pow + 1, left - pow + 1, prec);
+            for (j = 0; j < (len + 2 * pow - 1) / (2 * pow); j++)
+                _descent_worker(j, &work);
         }
-        else if (left > 0)
-            _acb_vec_set(pc, pb, left);
 
         swap = t;
         t = u;
@@ -115,6 +187,13 @@ _acb_poly_evaluate_vec_fast_precomp(acb_ptr vs, acb_srcptr poly,
     _acb_vec_clear(u, len);
 }
 
+void
+_acb_poly_evaluate_vec_fast_precomp(acb_ptr vs, acb_srcptr poly,
+    slong plen, acb_ptr * tree, slong len, slong prec)
+{
+    _acb_poly_evaluate_vec_fast_precomp_inv(vs, poly, plen, tree, NULL, len, prec);
+}
+
 void _acb_poly_evaluate_vec_fast(acb_ptr ys, acb_srcptr poly, slong plen,
     acb_srcptr xs, slong n, slong prec)
 {
@@ -9,8 +9,12 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <math.h>
 #include "acb_poly.h"
 
+/* use the Aberth iteration instead of Durand-Kerner from this degree */
+#define ABERTH_MIN_DEG 64
+
 slong
 _acb_get_mid_mag(const acb_t z)
 {
@@ -67,13 +71,58 @@ _acb_poly_roots_initial_values(acb_ptr roots, slong deg, slong prec)
     }
 }
 
+/* Points on a circle with radius |a_0 / a_n|^(1/n), the geometric mean
+   of the absolute values of the roots, rotated away from the real axis. */
+static void
+_acb_poly_roots_initial_values_circle(acb_ptr roots, acb_srcptr poly,
+    slong len, slong prec)
+{
+    slong i, deg = len - 1;
+    double theta;
+    arb_t r, t;
+
+    arb_init(r);
+    arb_init(t);
+
+    acb_abs(r, poly + 0, 30);
+    acb_abs(t, poly + deg, 30);
+    arb_div(r, r, t, 30);
+
+    if (arb_is_positive(r) && arb_is_finite(r))
+    {
+        arb_root_ui(r, r, deg, 30);
+        mag_zero(arb_radref(r));
+    }
+    else
+    {
+        arb_one(r);
+    }
+
+    for (i = 0; i < deg; i++)
+    {
+        theta = 2 * 3.141592653589793 * (i + 0.25) / deg + 0.4;
+        acb_zero(roots + i);
+        arf_set_d(arb_midref(acb_realref(roots + i)), cos(theta));
+        arf_set_d(arb_midref(acb_imagref(roots + i)), sin(theta));
+        acb_mul_arb(roots + i, roots + i, r, prec);
+        mag_zero(arb_radref(acb_realref(roots + i)));
+        mag_zero(arb_radref(acb_imagref(roots + i)));
+    }
+
+    arb_clear(r);
+    arb_clear(t);
+}
+
 slong
 _acb_poly_find_roots(acb_ptr roots,
     acb_srcptr poly,
     acb_srcptr initial, slong len, slong maxiter, slong prec)
 {
-    slong iter, i, deg;
+    slong iter, i, deg, isolated;
     slong rootmag, max_rootmag, correction, max_correction;
+    acb_ptr deriv = NULL;
+    int * converged = NULL;
+    int aberth;
 
     deg = len - 1;
 
@@ -99,14 +148,25 @@ _acb_poly_find_roots(acb_ptr roots,
         return 1;
     }
 
-    if (initial == NULL)
-        _acb_poly_roots_initial_values(roots, deg, prec);
-    else
+    aberth = (deg >= ABERTH_MIN_DEG);
+
+    if (initial != NULL)
         _acb_vec_set(roots, initial, deg);
+    else if (aberth)
+        _acb_poly_roots_initial_values_circle(roots, poly, len, prec);
+    else
+        _acb_poly_roots_initial_values(roots, deg, prec);
 
     if (maxiter == 0)
         maxiter = 2 * deg + n_sqrt(prec);
 
+    if (aberth)
+    {
+        deriv = _acb_vec_init(deg);
+        _acb_poly_derivative(deriv, poly, len, prec);
+        converged = flint_calloc(deg, sizeof(int));
+    }
+
     for (iter = 0; iter < maxiter; iter++)
     {
         max_rootmag = -ARF_PREC_EXACT;
@@ -116,7 +176,17 @@ _acb_poly_find_roots(acb_ptr roots,
             max_rootmag = FLINT_MAX(rootmag, max_rootmag);
         }
 
-        _acb_poly_refine_roots_durand_kerner(roots, poly, len, prec);
+        if (aberth)
+        {
+            /* stop once every root is frozen */
+            if (_acb_poly_refine_roots_aberth(roots, poly, deriv, len,
+                    converged, prec) == 0)
+                break;
+        }
+        else
+        {
+            _acb_poly_refine_roots_durand_kerner(roots, poly, len, prec);
+        }
 
         max_correction = -ARF_PREC_EXACT;
         for (i = 0; i < deg; i++)
@@ -138,7 +208,15 @@ _acb_poly_find_roots(acb_ptr roots,
             maxiter = FLINT_MIN(maxiter, iter + 4);
     }
 
-    return _acb_poly_validate_roots(roots, poly, len, prec);
+    isolated = _acb_poly_validate_roots(roots, poly, len, prec);
+
+    if (aberth)
+    {
+        _acb_vec_clear(deriv, deg);
+        flint_free(converged);
+    }
+
+    return isolated;
 }
 
 
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_poly.h"
 
 void
@@ -43,51 +44,88 @@ _acb_poly_interpolation_weights(acb_ptr w,
     _acb_vec_clear(tmp, len + 1);
 }
 
+typedef struct
+{
+    acb_ptr poly;
+    acb_ptr t;
+    acb_ptr u;
+    acb_srcptr pa;
+    slong pow;
+    slong len;
+    slong prec;
+}
+_interpolate_work_t;
+
+/* combines the k-th pair of blocks of length pow */
+static void
+_interpolate_worker(slong k, _interpolate_work_t * w)
+{
+    slong pow = w->pow, left;
+    acb_srcptr pa = w->pa + k * (2 * pow + 2);
+    acb_ptr pb = w->poly + k * 2 * pow;
+    acb_ptr t = w->t + k * 2 * pow;
+    acb_ptr u = w->u + k * 2 * pow;
+
+    left = w->len - k * 2 * pow;
+
+    if (left >= 2 * pow)
+    {
+        _acb_poly_mul(t, pa, pow + 1, pb + pow, pow, w->prec);
+        _acb_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, w->prec);
+        _acb_vec_add(pb, t, u, 2 * pow, w->prec);
+    }
+    else if (left > pow)
+    {
+        _acb_poly_mul(t, pa, pow + 1, pb + pow, left - pow, w->prec);
+        _acb_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, w->prec);
+        _acb_vec_add(pb, t, u, left, w->prec);
+    }
+}
+
 void
 _acb_poly_interpolate_fast_precomp(acb_ptr poly,
     acb_srcptr ys, acb_ptr * tree, acb_srcptr weights,
     slong len, slong prec)
 {
-    acb_ptr t, u, pa, pb;
-    slong i, pow, left;
+    _interpolate_work_t work;
+    slong i, k, num;
+    int threaded;
 
     if (len == 0)
         return;
 
-    t = _acb_vec_init(len);
-    u = _acb_vec_init(len);
+    work.poly = poly;
+    work.t = _acb_vec_init(len);
+    work.u = _acb_vec_init(len);
+    work.len = len;
+    work.prec = prec;
 
     for (i = 0; i < len; i++)
         acb_mul(poly + i, weights + i, ys + i, prec);
 
+    /* the pairs of each level are independent */
+    threaded = (len >= 64 && flint_get_num_threads() > 1);
+
     for (i = 0; i < FLINT_CLOG2(len); i++)
     {
-        pow = (WORD(1) << i);
-        pa = tree[i];
-        pb = poly;
-        left = len;
+        work.pow = (WORD(1) << i);
+        work.pa = tree[i];
+        num = (len + 2 * work.pow - 1) / (2 * work.pow);
 
-        while (left >= 2 * pow)
+        if (threaded)
         {
-            _acb_poly_mul(t, pa, pow + 1, pb + pow, pow, prec);
-            _acb_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, prec);
-            _acb_vec_add(pb, t, u, 2 * pow, prec);
-
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
+            flint_parallel_do((do_func_t) _interpolate_worker, &work, num, -1,
+                FLINT_PARALLEL_UNIFORM);
         }
-
-        if (left > pow)
+        else
         {
-            _acb_poly_mul(t, pa, pow + 1, pb + pow, left - pow, prec);
-            _acb_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, prec);
-            _acb_vec_add(pb, t, u, left, prec);
+            for (k = 0; k < num; k++)
+                _interpolate_worker(k, &work);
         }
     }
 
-    _acb_vec_clear(t, len);
-    _acb_vec_clear(u, len);
+    _acb_vec_clear(work.t, len);
+    _acb_vec_clear(work.u, len);
 }
 
 void
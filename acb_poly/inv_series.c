@@ -58,8 +58,11 @@ _acb_poly_inv_series(acb_ptr Qinv,
         {
             slong Qnlen, Wlen, W2len;
             acb_ptr W;
+            arb_arena_struct * arena;
 
-            W = _acb_vec_init(len);
+            arena = _arb_arena_thread();
+            arb_arena_push(arena);
+            W = _acb_arena_vec_init(arena, len);
 
             NEWTON_INIT(blen, len)
             NEWTON_LOOP(m, n)
@@ -74,7 +77,7 @@ _acb_poly_inv_series(acb_ptr Qinv,
             NEWTON_END_LOOP
             NEWTON_END
 
-            _acb_vec_clear(W, len);
+            arb_arena_pop(arena);
         }
     }
 }
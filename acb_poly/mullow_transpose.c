@@ -9,8 +9,31 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_poly.h"
 
+/* Run the real products on different threads when the factors have
+   at least this length. */
+#define MULLOW_TRANSPOSE_THREADED_MIN 32
+
+typedef struct
+{
+    arb_ptr z[4];
+    arb_srcptr x[4];
+    arb_srcptr y[4];
+    slong xlen;
+    slong ylen;
+    slong n;
+    slong prec;
+}
+_mullow_transpose_work_t;
+
+static void
+_mullow_transpose_worker(slong i, _mullow_transpose_work_t * w)
+{
+    _arb_poly_mullow(w->z[i], w->x[i], w->xlen, w->y[i], w->ylen, w->n, w->prec);
+}
+
 void
 _acb_poly_mullow_transpose(acb_ptr res,
     acb_srcptr poly1, slong len1,
@@ -52,20 +75,53 @@ _acb_poly_mullow_transpose(acb_ptr res,
         f[i] = *acb_imagref(res + i);
     }
 
-    _arb_poly_mullow(e, a, len1, c, len2, n, prec);
-    _arb_poly_mullow(t, b, len1, d, len2, n, prec);
-    _arb_vec_sub(e, e, t, n, prec);
-
-    _arb_poly_mullow(f, a, len1, d, len2, n, prec);
-    /* squaring */
-    if (poly1 == poly2 && len1 == len2)
+    if (FLINT_MIN(len1, len2) >= MULLOW_TRANSPOSE_THREADED_MIN &&
+        flint_get_num_threads() > 1)
     {
-        _arb_vec_scalar_mul_2exp_si(f, f, n, 1);
+        _mullow_transpose_work_t work;
+        int squaring = (poly1 == poly2 && len1 == len2);
+        arb_ptr u = _arb_vec_init(n);
+
+        /* ac, bd, ad and bc are independent; each product may
+           use further threads */
+        work.z[0] = e; work.x[0] = a; work.y[0] = c;
+        work.z[1] = t; work.x[1] = b; work.y[1] = d;
+        work.z[2] = f; work.x[2] = a; work.y[2] = d;
+        work.z[3] = u; work.x[3] = b; work.y[3] = c;
+        work.xlen = len1;
+        work.ylen = len2;
+        work.n = n;
+        work.prec = prec;
+
+        flint_parallel_do((do_func_t) _mullow_transpose_worker, &work,
+            squaring ? 3 : 4, -1, FLINT_PARALLEL_UNIFORM);
+
+        _arb_vec_sub(e, e, t, n, prec);
+
+        if (squaring)
+            _arb_vec_scalar_mul_2exp_si(f, f, n, 1);
+        else
+            _arb_vec_add(f, f, u, n, prec);
+
+        _arb_vec_clear(u, n);
     }
     else
     {
-        _arb_poly_mullow(t, b, len1, c, len2, n, prec);
-        _arb_vec_add(f, f, t, n, prec);
+        _arb_poly_mullow(e, a, len1, c, len2, n, prec);
+        _arb_poly_mullow(t, b, len1, d, len2, n, prec);
+        _arb_vec_sub(e, e, t, n, prec);
+
+        _arb_poly_mullow(f, a, len1, d, len2, n, prec);
+        /* squaring */
+        if (poly1 == poly2 && len1 == len2)
+        {
+            _arb_vec_scalar_mul_2exp_si(f, f, n, 1);
+        }
+        else
+        {
+            _arb_poly_mullow(t, b, len1, c, len2, n, prec);
+            _arb_vec_add(f, f, t, n, prec);
+        }
     }
 
     for (i = 0; i < n; i++)
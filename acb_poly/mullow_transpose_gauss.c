@@ -9,8 +9,31 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_poly.h"
 
+/* Run the real products on different threads when the factors have
+   at least this length. */
+#define MULLOW_TRANSPOSE_THREADED_MIN 32
+
+typedef struct
+{
+    arb_ptr z[3];
+    arb_srcptr x[3];
+    arb_srcptr y[3];
+    slong xlen;
+    slong ylen;
+    slong n;
+    slong prec;
+}
+_mullow_transpose_work_t;
+
+static void
+_mullow_transpose_worker(slong i, _mullow_transpose_work_t * w)
+{
+    _arb_poly_mullow(w->z[i], w->x[i], w->xlen, w->y[i], w->ylen, w->n, w->prec);
+}
+
 void
 _acb_poly_mullow_transpose_gauss(acb_ptr res,
     acb_srcptr poly1, slong len1,
@@ -56,9 +79,39 @@ _acb_poly_mullow_transpose_gauss(acb_ptr res,
     _arb_vec_add(t, a, b, len1, prec);
     _arb_vec_add(u, c, d, len2, prec);
 
-    _arb_poly_mullow(v, t, len1, u, len2, n, prec);
-    _arb_poly_mullow(t, a, len1, c, len2, n, prec);
-    _arb_poly_mullow(u, b, len1, d, len2, n, prec);
+    if (FLINT_MIN(len1, len2) >= MULLOW_TRANSPOSE_THREADED_MIN &&
+        flint_get_num_threads() > 1)
+    {
+        _mullow_transpose_work_t work;
+        arb_ptr ab, cd;
+
+        /* the three products are independent once the sums are
+           moved out of the way; each product may use further threads */
+        ab = _arb_vec_init(len1);
+        cd = _arb_vec_init(len2);
+        _arb_vec_swap(ab, t, len1);
+        _arb_vec_swap(cd, u, len2);
+
+        work.z[0] = v; work.x[0] = ab; work.y[0] = cd;
+        work.z[1] = t; work.x[1] = a; work.y[1] = c;
+        work.z[2] = u; work.x[2] = b; work.y[2] = d;
+        work.xlen = len1;
+        work.ylen = len2;
+        work.n = n;
+        work.prec = prec;
+
+        flint_parallel_do((do_func_t) _mullow_transpose_worker, &work, 3, -1,
+            FLINT_PARALLEL_UNIFORM);
+
+        _arb_vec_clear(ab, len1);
+        _arb_vec_clear(cd, len2);
+    }
+    else
+    {
+        _arb_poly_mullow(v, t, len1, u, len2, n, prec);
+        _arb_poly_mullow(t, a, len1, c, len2, n, prec);
+        _arb_poly_mullow(u, b, len1, d, len2, n, prec);
+    }
 
     _arb_vec_sub(e, t, u, n, prec);
     _arb_vec_sub(f, v, t, n, prec);
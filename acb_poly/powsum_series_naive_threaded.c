@@ -9,9 +9,13 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
-#include <pthread.h>
+#include "flint/thread_support.h"
 #include "acb_poly.h"
 
+/* Minimum number of terms (or coefficients, when splitting the
+   coefficients) per thread. */
+#define POWSUM_THREADED_MIN_TERMS 16
+
 typedef struct
 {
     acb_ptr z;
@@ -26,10 +30,10 @@ typedef struct
 }
 powsum_arg_t;
 
-void *
-_acb_zeta_powsum_evaluator(void * arg_ptr)
+static void
+_acb_zeta_powsum_worker(slong j, powsum_arg_t * args)
 {
-    powsum_arg_t arg = *((powsum_arg_t *) arg_ptr);
+    powsum_arg_t arg = args[j];
     slong i, k;
     int q_one, s_int;
 
@@ -117,27 +121,29 @@ _acb_zeta_powsum_evaluator(void * arg_ptr)
     acb_clear(qpow);
     acb_clear(negs);
     arb_clear(f);
-
-    flint_cleanup();
-
-    return NULL;
 }
 
 void
 _acb_poly_powsum_series_naive_threaded(acb_ptr z,
     const acb_t s, const acb_t a, const acb_t q, slong n, slong len, slong prec)
 {
-    pthread_t * threads;
     powsum_arg_t * args;
     slong i, num_threads;
     int split_each_term;
 
+    split_each_term = (len > 1000);
+
     num_threads = flint_get_num_threads();
+    num_threads = FLINT_MIN(num_threads,
+        (split_each_term ? len : n) / POWSUM_THREADED_MIN_TERMS);
 
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
-    args = flint_malloc(sizeof(powsum_arg_t) * num_threads);
+    if (num_threads <= 1)
+    {
+        _acb_poly_powsum_series_naive(z, s, a, q, n, len, prec);
+        return;
+    }
 
-    split_each_term = (len > 1000);
+    args = flint_malloc(sizeof(powsum_arg_t) * num_threads);
 
     for (i = 0; i < num_threads; i++)
     {
@@ -166,13 +172,10 @@ _acb_poly_powsum_series_naive_threaded(acb_ptr z,
         }
 
         args[i].prec = prec;
-        pthread_create(&threads[i], NULL, _acb_zeta_powsum_evaluator, &args[i]);
     }
 
-    for (i = 0; i < num_threads; i++)
-    {
-        pthread_join(threads[i], NULL);
-    }
+    flint_parallel_do((do_func_t) _acb_zeta_powsum_worker, args, num_threads,
+        -1, FLINT_PARALLEL_UNIFORM);
 
     if (!split_each_term)
     {
@@ -184,7 +187,6 @@ _acb_poly_powsum_series_naive_threaded(acb_ptr z,
         }
     }
 
-    flint_free(threads);
     flint_free(args);
 }
 
@@ -0,0 +1,89 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "acb_poly.h"
+#include "flint/profiler.h"
+
+/* Times acb_poly_find_roots on high-degree polynomials with one thread
+   and with the given number of threads. The test polynomials are the
+   "easy" polynomials 1 + 2x + ... + (n+1)x^n of examples/poly_roots.c
+   and random polynomials with coefficients +/- 1, whose roots cluster
+   near the unit circle. The whole computation for a factor of this
+   degree can be timed with examples/poly_roots (option -threads). */
+
+#define NUM_DEG 4
+
+int main(int argc, char * argv[])
+{
+    slong deg_tab[NUM_DEG] = { 2000, 5000, 10000, 20000 };
+    slong i, k, deg, maxdeg, threads, isolated, prec;
+    int family, t;
+    acb_poly_t f;
+    acb_ptr roots;
+    flint_rand_t state;
+    timeit_t timer;
+
+    maxdeg = (argc > 1) ? atol(argv[1]) : 5000;
+    threads = (argc > 2) ? atol(argv[2]) : 8;
+    prec = (argc > 3) ? atol(argv[3]) : 64;
+
+    flint_printf("usage: p-find_roots [maxdeg] [threads] [prec]\n");
+    flint_printf("maxdeg = %wd, threads = %wd, prec = %wd\n\n", maxdeg, threads, prec);
+
+    flint_randinit(state);
+    acb_poly_init(f);
+
+    for (family = 0; family < 2; family++)
+    {
+        for (i = 0; i < NUM_DEG; i++)
+        {
+            deg = deg_tab[i];
+
+            if (deg > maxdeg)
+                continue;
+
+            acb_poly_zero(f);
+            for (k = 0; k <= deg; k++)
+            {
+                if (family == 0)
+                    acb_poly_set_coeff_si(f, k, k + 1);
+                else
+                    acb_poly_set_coeff_si(f, k, n_randint(state, 2) ? 1 : -1);
+            }
+
+            roots = _acb_vec_init(deg);
+
+            for (t = 0; t < 2; t++)
+            {
+                flint_set_num_threads(t == 0 ? 1 : threads);
+
+                timeit_start(timer);
+                isolated = acb_poly_find_roots(roots, f, NULL, 0, prec);
+                timeit_stop(timer);
+
+                flint_printf("%-8s deg = %6wd  threads = %3wd  isolated = %6wd  %10.3f s\n",
+                    family == 0 ? "easy" : "random", deg, t == 0 ? WORD(1) : threads,
+                    isolated, 0.001 * timer->wall);
+            }
+
+            _acb_vec_clear(roots, deg);
+        }
+
+        flint_printf("\n");
+    }
+
+    flint_set_num_threads(1);
+    acb_poly_clear(f);
+    flint_randclear(state);
+    flint_cleanup();
+    return 0;
+}
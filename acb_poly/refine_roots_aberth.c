@@ -0,0 +1,345 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "acb_poly.h"
+
+/*
+One step of the Aberth-Ehrlich iteration
+
+    z_i <- z_i - w_i / (1 - w_i sum_{j != i} 1 / (z_i - z_j)),
+    w_i = p(z_i) / p'(z_i).
+
+All corrections are computed from the same approximations before any
+of them is applied, so the roots can be distributed over threads and
+the result does not depend on the number of threads. As in the
+Durand-Kerner iteration, the radii are ignored and the radius of each
+updated root is set to the size of its correction.
+*/
+
+/* process the active roots in chunks of this size */
+#define ABERTH_CHUNK 16
+
+/* use fast multipoint evaluation from this many active roots */
+#define ABERTH_FAST_EVAL_MIN 1024
+
+/* minimum relative accuracy of a value from fast multipoint evaluation;
+   less accurate values are recomputed using Horner's rule */
+#define ABERTH_FAST_EVAL_ACCURACY 24
+
+/* a root is frozen once its correction is this many bits below
+   the working precision relative to the root */
+#define ABERTH_FREEZE_BITS 4
+
+/* the same helpers as in refine_roots_durand_kerner.c */
+
+static __inline__ void
+acb_sub_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+    arf_sub(arb_midref(acb_realref(z)),
+        arb_midref(acb_realref(x)),
+        arb_midref(acb_realref(y)), prec, ARF_RND_DOWN);
+    arf_sub(arb_midref(acb_imagref(z)),
+        arb_midref(acb_imagref(x)),
+        arb_midref(acb_imagref(y)), prec, ARF_RND_DOWN);
+}
+
+static __inline__ void
+acb_add_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+    arf_add(arb_midref(acb_realref(z)),
+        arb_midref(acb_realref(x)),
+        arb_midref(acb_realref(y)), prec, ARF_RND_DOWN);
+    arf_add(arb_midref(acb_imagref(z)),
+        arb_midref(acb_imagref(x)),
+        arb_midref(acb_imagref(y)), prec, ARF_RND_DOWN);
+}
+
+static __inline__ void
+acb_mul_mid(acb_t z, const acb_t x, const acb_t y, slong prec)
+{
+    arf_complex_mul(arb_midref(acb_realref(z)), arb_midref(acb_imagref(z)),
+        arb_midref(acb_realref(x)), arb_midref(acb_imagref(x)),
+        arb_midref(acb_realref(y)), arb_midref(acb_imagref(y)),
+        prec, ARF_RND_DOWN);
+}
+
+static __inline__ void
+acb_inv_mid(acb_t z, const acb_t x, slong prec)
+{
+    arf_t t;
+    arf_init(t);
+
+#define a arb_midref(acb_realref(x))
+#define b arb_midref(acb_imagref(x))
+#define e arb_midref(acb_realref(z))
+#define f arb_midref(acb_imagref(z))
+
+    arf_mul(t, a, a, prec, ARF_RND_DOWN);
+    arf_addmul(t, b, b, prec, ARF_RND_DOWN);
+
+    arf_div(e, a, t, prec, ARF_RND_DOWN);
+    arf_div(f, b, t, prec, ARF_RND_DOWN);
+
+    arf_neg(f, f);
+
+#undef a
+#undef b
+#undef e
+#undef f
+
+    arf_clear(t);
+}
+
+static __inline__ int
+acb_mid_is_zero(const acb_t x)
+{
+    return arf_is_zero(arb_midref(acb_realref(x))) &&
+           arf_is_zero(arb_midref(acb_imagref(x)));
+}
+
+static __inline__ slong
+acb_mid_mag(const acb_t z)
+{
+    return FLINT_MAX(arf_abs_bound_lt_2exp_si(arb_midref(acb_realref(z))),
+                     arf_abs_bound_lt_2exp_si(arb_midref(acb_imagref(z))));
+}
+
+typedef struct
+{
+    acb_ptr corr;
+    int * fail;
+    acb_srcptr roots;
+    acb_srcptr poly;
+    acb_srcptr deriv;
+    acb_srcptr vals;
+    acb_srcptr dvals;
+    const slong * active;
+    slong nactive;
+    slong deg;
+    slong prec;
+}
+_aberth_work_t;
+
+static void
+_aberth_worker(slong c, _aberth_work_t * w)
+{
+    slong k, k1, i, j, deg = w->deg, prec = w->prec;
+    slong minacc = FLINT_MIN(prec / 2, ABERTH_FAST_EVAL_ACCURACY);
+    acb_t x, y, s, t;
+
+    acb_init(x);
+    acb_init(y);
+    acb_init(s);
+    acb_init(t);
+
+    k1 = FLINT_MIN((c + 1) * ABERTH_CHUNK, w->nactive);
+
+    for (k = c * ABERTH_CHUNK; k < k1; k++)
+    {
+        i = w->active[k];
+
+        if (w->vals != NULL &&
+            acb_rel_accuracy_bits(w->vals + k) >= minacc &&
+            acb_rel_accuracy_bits(w->dvals + k) >= minacc)
+        {
+            acb_get_mid(x, w->vals + k);
+            acb_get_mid(y, w->dvals + k);
+        }
+        else
+        {
+            _acb_poly_evaluate_mid(x, w->poly, deg + 1, w->roots + i, prec);
+            _acb_poly_evaluate_mid(y, w->deriv, deg, w->roots + i, prec);
+        }
+
+        w->fail[k] = acb_mid_is_zero(y);
+
+        if (w->fail[k])
+        {
+            acb_zero(w->corr + k);
+            continue;
+        }
+
+        /* x = p(z_i) / p'(z_i) */
+        acb_inv_mid(t, y, prec);
+        acb_mul_mid(x, x, t, prec);
+
+        /* s = sum_{j != i} 1 / (z_i - z_j) */
+        acb_zero(s);
+        for (j = 0; j < deg; j++)
+        {
+            if (j != i)
+            {
+                acb_sub_mid(t, w->roots + i, w->roots + j, prec);
+
+                if (!acb_mid_is_zero(t))
+                {
+                    acb_inv_mid(t, t, prec);
+                    acb_add_mid(s, s, t, prec);
+                }
+            }
+        }
+
+        /* correction x / (1 - x s) */
+        acb_mul_mid(t, x, s, prec);
+        acb_one(y);
+        acb_sub_mid(t, y, t, prec);
+
+        if (acb_mid_is_zero(t))
+        {
+            acb_set(w->corr + k, x);
+        }
+        else
+        {
+            acb_inv_mid(t, t, prec);
+            acb_mul_mid(w->corr + k, x, t, prec);
+        }
+    }
+
+    acb_clear(x);
+    acb_clear(y);
+    acb_clear(s);
+    acb_clear(t);
+}
+
+/* values of poly and deriv at the active roots, or NULL */
+static void
+_aberth_fast_eval(acb_ptr vals, acb_ptr dvals, acb_srcptr roots,
+    const slong * active, slong nactive,
+    acb_srcptr poly, acb_srcptr deriv, slong len, slong prec)
+{
+    acb_ptr xs, pmid;
+    acb_ptr * tree;
+    acb_ptr * inv;
+    slong k, wprec;
+
+    /* the remainder tree loses some bits */
+    wprec = prec + 2 * FLINT_BIT_COUNT(nactive) + 10;
+
+    xs = _acb_vec_init(nactive);
+    pmid = _acb_vec_init(2 * len - 1);
+
+    for (k = 0; k < nactive; k++)
+        acb_get_mid(xs + k, roots + active[k]);
+    for (k = 0; k < len; k++)
+        acb_get_mid(pmid + k, poly + k);
+    for (k = 0; k < len - 1; k++)
+        acb_get_mid(pmid + len + k, deriv + k);
+
+    tree = _acb_poly_tree_alloc(nactive);
+    _acb_poly_tree_build(tree, xs, nactive, wprec);
+    inv = _acb_poly_tree_inverses_alloc(nactive);
+    _acb_poly_tree_inverses(inv, tree, nactive, wprec);
+
+    _acb_poly_evaluate_vec_fast_precomp_inv(vals, pmid, len, tree, inv, nactive, wprec);
+    _acb_poly_evaluate_vec_fast_precomp_inv(dvals, pmid + len, len - 1, tree, inv, nactive, wprec);
+
+    _acb_poly_tree_inverses_free(inv, nactive);
+    _acb_poly_tree_free(tree, nactive);
+    _acb_vec_clear(xs, nactive);
+    _acb_vec_clear(pmid, 2 * len - 1);
+}
+
+slong
+_acb_poly_refine_roots_aberth(acb_ptr roots, acb_srcptr poly,
+    acb_srcptr deriv, slong len, int * converged, slong prec)
+{
+    _aberth_work_t work;
+    acb_ptr corr, vals, dvals;
+    slong * active;
+    int * fail;
+    slong i, k, nactive, deg, nchunks;
+
+    deg = len - 1;
+
+    active = flint_malloc(sizeof(slong) * deg);
+
+    for (i = nactive = 0; i < deg; i++)
+        if (converged == NULL || !converged[i])
+            active[nactive++] = i;
+
+    if (nactive == 0)
+    {
+        flint_free(active);
+        return 0;
+    }
+
+    corr = _acb_vec_init(nactive);
+    fail = flint_calloc(nactive, sizeof(int));
+    vals = dvals = NULL;
+
+    if (nactive >= ABERTH_FAST_EVAL_MIN)
+    {
+        vals = _acb_vec_init(nactive);
+        dvals = _acb_vec_init(nactive);
+        _aberth_fast_eval(vals, dvals, roots, active, nactive,
+            poly, deriv, len, prec);
+    }
+
+    work.corr = corr;
+    work.fail = fail;
+    work.roots = roots;
+    work.poly = poly;
+    work.deriv = deriv;
+    work.vals = vals;
+    work.dvals = dvals;
+    work.active = active;
+    work.nactive = nactive;
+    work.deg = deg;
+    work.prec = prec;
+
+    nchunks = (nactive + ABERTH_CHUNK - 1) / ABERTH_CHUNK;
+
+    if (nchunks > 1 && flint_get_num_threads() > 1)
+    {
+        flint_parallel_do((do_func_t) _aberth_worker, &work, nchunks, -1,
+            FLINT_PARALLEL_DYNAMIC);
+    }
+    else
+    {
+        for (k = 0; k < nchunks; k++)
+            _aberth_worker(k, &work);
+    }
+
+    for (k = 0; k < nactive; k++)
+    {
+        i = active[k];
+
+        if (fail[k])
+        {
+            /* p'(z_i) vanishes; leave z_i in place, marked as unconverged */
+            mag_one(arb_radref(acb_realref(roots + i)));
+            mag_one(arb_radref(acb_imagref(roots + i)));
+            continue;
+        }
+
+        acb_sub_mid(roots + i, roots + i, corr + k, prec);
+
+        arf_get_mag(arb_radref(acb_realref(roots + i)), arb_midref(acb_realref(corr + k)));
+        arf_get_mag(arb_radref(acb_imagref(roots + i)), arb_midref(acb_imagref(corr + k)));
+
+        if (converged != NULL && (acb_mid_is_zero(corr + k) ||
+            acb_mid_mag(corr + k) < acb_mid_mag(roots + i) - prec + ABERTH_FREEZE_BITS))
+            converged[i] = 1;
+    }
+
+    if (vals != NULL)
+    {
+        _acb_vec_clear(vals, nactive);
+        _acb_vec_clear(dvals, nactive);
+    }
+
+    _acb_vec_clear(corr, nactive);
+    flint_free(fail);
+    flint_free(active);
+
+    return nactive;
+}
@@ -17,6 +17,7 @@ _acb_poly_sin_cos_series_basecase(acb_ptr s, acb_ptr c, acb_srcptr h, slong hlen
 {
     slong k, alen = FLINT_MIN(n, hlen);
     acb_ptr a;
+    arb_arena_struct * arena;
     acb_t t, u;
 
     if (times_pi)
@@ -33,7 +34,9 @@ _acb_poly_sin_cos_series_basecase(acb_ptr s, acb_ptr c, acb_srcptr h, slong hlen
 
     acb_init(t);
     acb_init(u);
-    a = _acb_vec_init(alen);
+    arena = _arb_arena_thread();
+    arb_arena_push(arena);
+    a = _acb_arena_vec_init(arena, alen);
 
     for (k = 1; k < alen; k++)
         acb_mul_ui(a + k, h + k, k, prec);
@@ -54,7 +57,7 @@ _acb_poly_sin_cos_series_basecase(acb_ptr s, acb_ptr c, acb_srcptr h, slong hlen
 
     acb_clear(t);
     acb_clear(u);
-    _acb_vec_clear(a, alen);
+    arb_arena_pop(arena);
 }
 
 void
@@ -97,6 +97,49 @@ int main()
         acb_poly_clear(d);
     }
 
+    /* long series: Kinoshita-Li (the default) and Brent-Kung */
+    for (iter = 0; iter < 3 * arb_test_multiplier(); iter++)
+    {
+        acb_poly_t f, g, h1, h2;
+        slong i, n, prec;
+
+        n = 1000 + n_randint(state, 300);
+        prec = 64 + n_randint(state, 200);
+
+        acb_poly_init(f);
+        acb_poly_init(g);
+        acb_poly_init(h1);
+        acb_poly_init(h2);
+
+        /* g = x + (small terms) keeps the coefficients of f(g) moderate */
+        acb_poly_randtest(f, state, 64 + n_randint(state, n), prec, 0);
+        acb_poly_randtest(g, state, n, prec, 0);
+        for (i = 0; i < f->length; i++)
+            acb_get_mid(f->coeffs + i, f->coeffs + i);
+        for (i = 0; i < g->length; i++)
+        {
+            acb_get_mid(g->coeffs + i, g->coeffs + i);
+            acb_mul_2exp_si(g->coeffs + i, g->coeffs + i, -2);
+        }
+        acb_poly_set_coeff_si(g, 0, 0);
+        acb_poly_set_coeff_si(g, 1, 1);
+
+        acb_poly_compose_series(h1, f, g, n, prec);
+        acb_poly_compose_series_brent_kung(h2, f, g, n, prec);
+
+        if (!acb_poly_overlaps(h1, h2))
+        {
+            flint_printf("FAIL (long series)\n\n");
+            flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+            flint_abort();
+        }
+
+        acb_poly_clear(f);
+        acb_poly_clear(g);
+        acb_poly_clear(h1);
+        acb_poly_clear(h2);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
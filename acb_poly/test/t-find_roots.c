@@ -91,6 +91,142 @@ int main()
         acb_poly_clear(C);
     }
 
+    /* higher degree (Aberth iteration), known roots, threads */
+    for (iter = 0; iter < 20 * arb_test_multiplier(); iter++)
+    {
+        acb_poly_t A;
+        acb_ptr xs, roots, roots2;
+        slong i, j, deg, isolated, isolated2, found;
+        slong prec = 64 + n_randint(state, 200);
+
+        deg = 60 + n_randint(state, 60);
+
+        acb_poly_init(A);
+        xs = _acb_vec_init(deg);
+        roots = _acb_vec_init(deg);
+        roots2 = _acb_vec_init(deg);
+
+        /* distinct roots on a grid, so that the polynomial is exact */
+        for (i = 0; i < deg; i++)
+        {
+            do
+            {
+                arb_set_si(acb_realref(xs + i), n_randint(state, 41) - 20);
+                arb_set_si(acb_imagref(xs + i), n_randint(state, 41) - 20);
+                for (j = 0; j < i; j++)
+                    if (acb_equal(xs + i, xs + j))
+                        break;
+            }
+            while (j < i);
+        }
+
+        acb_poly_product_roots(A, xs, deg, 20 * deg + 100);
+
+        flint_set_num_threads(1);
+        isolated = acb_poly_find_roots(roots, A, NULL, 0, prec);
+        flint_set_num_threads(2 + n_randint(state, 3));
+        isolated2 = acb_poly_find_roots(roots2, A, NULL, 0, prec);
+        flint_set_num_threads(1);
+
+        for (i = 0; i < deg; i++)
+            if (!acb_equal(roots + i, roots2 + i))
+                break;
+
+        if (isolated != isolated2 || i < deg)
+        {
+            flint_printf("FAIL: thread dependence\n");
+            flint_printf("deg = %wd, prec = %wd\n", deg, prec);
+            flint_abort();
+        }
+
+        /* each isolated root contains one of the true roots, and
+           exactly one if all roots are isolated */
+        for (i = 0; i < isolated; i++)
+        {
+            found = 0;
+            for (j = 0; j < deg; j++)
+                found += acb_contains(roots + i, xs + j);
+
+            if (found == 0 || (isolated == deg && found != 1))
+            {
+                flint_printf("FAIL: isolated root\n");
+                flint_printf("deg = %wd, prec = %wd, i = %wd, found = %wd\n",
+                    deg, prec, i, found);
+                acb_printd(roots + i, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_poly_clear(A);
+        _acb_vec_clear(xs, deg);
+        _acb_vec_clear(roots, deg);
+        _acb_vec_clear(roots2, deg);
+    }
+
+    /* degree above the fast multipoint evaluation cutoff: x^n - 1 */
+    for (iter = 0; iter < 1 * arb_test_multiplier(); iter++)
+    {
+        acb_poly_t A;
+        acb_ptr roots, roots2;
+        acb_t t;
+        slong i, deg, isolated, isolated2;
+        slong prec = 64 + n_randint(state, 64);
+
+        deg = 1024 + n_randint(state, 32);
+
+        acb_poly_init(A);
+        acb_init(t);
+        roots = _acb_vec_init(deg);
+        roots2 = _acb_vec_init(deg);
+
+        acb_poly_set_coeff_si(A, 0, -1);
+        acb_poly_set_coeff_si(A, deg, 1);
+
+        flint_set_num_threads(1);
+        isolated = acb_poly_find_roots(roots, A, NULL, 0, prec);
+        flint_set_num_threads(2 + n_randint(state, 3));
+        isolated2 = acb_poly_find_roots(roots2, A, NULL, 0, prec);
+        flint_set_num_threads(1);
+
+        for (i = 0; i < deg; i++)
+            if (!acb_equal(roots + i, roots2 + i))
+                break;
+
+        if (isolated != isolated2 || i < deg)
+        {
+            flint_printf("FAIL: thread dependence (fast evaluation)\n");
+            flint_printf("deg = %wd, prec = %wd\n", deg, prec);
+            flint_abort();
+        }
+
+        if (isolated != deg)
+        {
+            flint_printf("FAIL: isolation (fast evaluation)\n");
+            flint_printf("deg = %wd, prec = %wd, isolated = %wd\n",
+                deg, prec, isolated);
+            flint_abort();
+        }
+
+        for (i = 0; i < deg; i++)
+        {
+            acb_pow_ui(t, roots + i, deg, prec);
+            acb_sub_ui(t, t, 1, prec);
+
+            if (!acb_contains_zero(t))
+            {
+                flint_printf("FAIL: poly(root) does not contain zero (fast evaluation)\n");
+                flint_printf("deg = %wd, prec = %wd, i = %wd\n", deg, prec, i);
+                acb_printd(roots + i, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_poly_clear(A);
+        acb_clear(t);
+        _acb_vec_clear(roots, deg);
+        _acb_vec_clear(roots2, deg);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
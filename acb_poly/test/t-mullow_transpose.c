@@ -165,6 +165,45 @@ int main()
         acb_poly_clear(ab2);
     }
 
+    /* threaded evaluation gives identical results */
+    for (iter = 0; iter < 20 * arb_test_multiplier(); iter++)
+    {
+        slong bits, trunc;
+        acb_poly_t a, b, ab, ab2;
+        acb_poly_struct * y;
+
+        bits = 2 + n_randint(state, 300);
+        trunc = n_randint(state, 300);
+
+        acb_poly_init(a);
+        acb_poly_init(b);
+        acb_poly_init(ab);
+        acb_poly_init(ab2);
+
+        acb_poly_randtest(a, state, 1 + n_randint(state, 300), bits, 5);
+        acb_poly_randtest(b, state, 1 + n_randint(state, 300), bits, 5);
+        y = n_randint(state, 2) ? a : b;
+
+        flint_set_num_threads(1);
+        acb_poly_mullow_transpose(ab, a, y, trunc, bits);
+        flint_set_num_threads(2 + n_randint(state, 5));
+        acb_poly_mullow_transpose(ab2, a, y, trunc, bits);
+        flint_set_num_threads(1);
+
+        if (!acb_poly_equal(ab, ab2))
+        {
+            flint_printf("FAIL (threads)\n\n");
+            flint_printf("bits = %wd\n", bits);
+            flint_printf("trunc = %wd\n", trunc);
+            flint_abort();
+        }
+
+        acb_poly_clear(a);
+        acb_poly_clear(b);
+        acb_poly_clear(ab);
+        acb_poly_clear(ab2);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
@@ -80,6 +80,44 @@ int main()
         acb_poly_clear(c);
     }
 
+    /* long series: Newton iteration with Kinoshita-Li composition
+       (the default) and fast Lagrange inversion */
+    for (iter = 0; iter < 1 * arb_test_multiplier(); iter++)
+    {
+        acb_poly_t g, h1, h2;
+        slong i, n, prec;
+
+        n = 2000 + n_randint(state, 100);
+        prec = 64 + n_randint(state, 200);
+
+        acb_poly_init(g);
+        acb_poly_init(h1);
+        acb_poly_init(h2);
+
+        acb_poly_randtest(g, state, n, prec, 0);
+        for (i = 0; i < g->length; i++)
+        {
+            acb_get_mid(g->coeffs + i, g->coeffs + i);
+            acb_mul_2exp_si(g->coeffs + i, g->coeffs + i, -2);
+        }
+        acb_poly_set_coeff_si(g, 0, 0);
+        acb_poly_set_coeff_si(g, 1, 1);
+
+        acb_poly_revert_series(h1, g, n, prec);
+        acb_poly_revert_series_lagrange_fast(h2, g, n, prec);
+
+        if (!acb_poly_overlaps(h1, h2))
+        {
+            flint_printf("FAIL (long series)\n\n");
+            flint_printf("n = %wd, prec = %wd\n\n", n, prec);
+            flint_abort();
+        }
+
+        acb_poly_clear(g);
+        acb_poly_clear(h1);
+        acb_poly_clear(h2);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
@@ -9,8 +9,13 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_poly.h"
 
+/* Distribute the nodes of a level over threads when there are
+   at least this many points. */
+#define TREE_THREADED_MIN_LEN 64
+
 acb_ptr * _acb_poly_tree_alloc(slong len)
 {
     acb_ptr * tree = NULL;
@@ -40,12 +45,41 @@ void _acb_poly_tree_free(acb_ptr * tree, slong len)
     }
 }
 
+typedef struct
+{
+    acb_srcptr pa;
+    acb_ptr pb;
+    slong pow;
+    slong len;
+    slong prec;
+}
+_tree_build_work_t;
+
+/* node k of the next level from nodes 2k, 2k + 1 of level pow */
+static void
+_tree_build_worker(slong k, _tree_build_work_t * w)
+{
+    slong pow = w->pow, left;
+    acb_srcptr pa = w->pa + k * (2 * pow + 2);
+    acb_ptr pb = w->pb + k * (2 * pow + 1);
+
+    left = w->len - k * 2 * pow;
+
+    if (left >= 2 * pow)
+        _acb_poly_mul_monic(pb, pa, pow + 1, pa + pow + 1, pow + 1, w->prec);
+    else if (left > pow)
+        _acb_poly_mul_monic(pb, pa, pow + 1, pa + pow + 1, left - pow + 1, w->prec);
+    else if (left > 0)
+        _acb_vec_set(pb, pa, left + 1);
+}
+
 void
 _acb_poly_tree_build(acb_ptr * tree, acb_srcptr roots, slong len, slong prec)
 {
     slong height, pow, left, i;
     acb_ptr pa, pb;
     acb_srcptr a, b;
+    int threaded;
 
     if (len == 0)
         return;
@@ -82,10 +116,29 @@ _acb_poly_tree_build(acb_ptr * tree, acb_srcptr roots, slong len, slong prec)
         }
     }
 
+    threaded = (len >= TREE_THREADED_MIN_LEN && flint_get_num_threads() > 1);
+
     for (i = 1; i < height - 1; i++)
     {
-        left = len;
         pow = WORD(1) << i;
+
+        /* the nodes of a level are independent */
+        if (threaded)
+        {
+            _tree_build_work_t work;
+
+            work.pa = tree[i];
+            work.pb = tree[i + 1];
+            work.pow = pow;
+            work.len = len;
+            work.prec = prec;
+
+            flint_parallel_do((do_func_t) _tree_build_worker, &work,
+                (len + 2 * pow - 1) / (2 * pow), -1, FLINT_PARALLEL_UNIFORM);
+            continue;
+        }
+
+        left = len;
         pa = tree[i];
         pb = tree[i + 1];
 
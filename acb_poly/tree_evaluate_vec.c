@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_poly.h"
+
+void
+_acb_poly_tree_evaluate_vec(acb_ptr ys, acb_srcptr poly, slong plen,
+    const acb_poly_tree_t T, slong prec)
+{
+    _acb_poly_evaluate_vec_fast_precomp_inv(ys, poly, plen,
+        T->tree, T->inv, T->len, prec);
+}
+
+void
+acb_poly_tree_evaluate_vec(acb_ptr ys, const acb_poly_t poly,
+    const acb_poly_tree_t T, slong prec)
+{
+    _acb_poly_tree_evaluate_vec(ys, poly->coeffs, poly->length, T, prec);
+}
@@ -0,0 +1,38 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_poly.h"
+
+void
+_acb_poly_tree_interpolate(acb_ptr poly, acb_srcptr ys,
+    const acb_poly_tree_t T, slong prec)
+{
+    _acb_poly_interpolate_fast_precomp(poly, ys, T->tree, T->weights, T->len, prec);
+}
+
+void
+acb_poly_tree_interpolate(acb_poly_t poly, acb_srcptr ys,
+    const acb_poly_tree_t T, slong prec)
+{
+    slong n = T->len;
+
+    if (n == 0)
+    {
+        acb_poly_zero(poly);
+    }
+    else
+    {
+        acb_poly_fit_length(poly, n);
+        _acb_poly_set_length(poly, n);
+        _acb_poly_tree_interpolate(poly->coeffs, ys, T, prec);
+        _acb_poly_normalise(poly);
+    }
+}
@@ -9,8 +9,45 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_poly.h"
 
+/* compute the inclusions and overlaps in parallel from this degree */
+#define VALIDATE_THREADED_MIN_DEG 64
+
+typedef struct
+{
+    acb_ptr roots;
+    acb_srcptr poly;
+    acb_srcptr deriv;
+    int * overlap;
+    slong len;
+    slong prec;
+}
+_validate_work_t;
+
+static void
+_inclusion_worker(slong i, _validate_work_t * w)
+{
+    _acb_poly_root_inclusion(w->roots + i, w->roots + i,
+        w->poly, w->deriv, w->len, w->prec);
+}
+
+static void
+_overlap_worker(slong i, _validate_work_t * w)
+{
+    slong j;
+
+    for (j = 0; j < w->len - 1; j++)
+    {
+        if (j != i && acb_overlaps(w->roots + i, w->roots + j))
+        {
+            w->overlap[i] = 1;
+            break;
+        }
+    }
+}
+
 slong
 _acb_poly_validate_roots(acb_ptr roots,
         acb_srcptr poly, slong len, slong prec)
@@ -29,21 +66,42 @@ _acb_poly_validate_roots(acb_ptr roots,
 
     _acb_poly_derivative(deriv, poly, len, prec);
 
-    /* compute an inclusion interval for each point */
-    for (i = 0; i < deg; i++)
+    if (deg >= VALIDATE_THREADED_MIN_DEG && flint_get_num_threads() > 1)
     {
-        _acb_poly_root_inclusion(roots + i, roots + i,
-            poly, deriv, len, prec);
-    }
+        _validate_work_t work;
 
-    /* find which points do not overlap with any other points */
-    for (i = 0; i < deg; i++)
+        work.roots = roots;
+        work.poly = poly;
+        work.deriv = deriv;
+        work.overlap = overlap;
+        work.len = len;
+        work.prec = prec;
+
+        /* each point is independent, and each overlap flag is
+           written only by the task of its own point */
+        flint_parallel_do((do_func_t) _inclusion_worker, &work, deg, -1,
+            FLINT_PARALLEL_UNIFORM);
+        flint_parallel_do((do_func_t) _overlap_worker, &work, deg, -1,
+            FLINT_PARALLEL_UNIFORM);
+    }
+    else
     {
-        for (j = i + 1; j < deg; j++)
+        /* compute an inclusion interval for each point */
+        for (i = 0; i < deg; i++)
+        {
+            _acb_poly_root_inclusion(roots + i, roots + i,
+                poly, deriv, len, prec);
+        }
+
+        /* find which points do not overlap with any other points */
+        for (i = 0; i < deg; i++)
         {
-            if (acb_overlaps(roots + i, roots + j))
+            for (j = i + 1; j < deg; j++)
             {
-                overlap[i] = overlap[j] = 1;
+                if (acb_overlaps(roots + i, roots + j))
+                {
+                    overlap[i] = overlap[j] = 1;
+                }
             }
         }
     }
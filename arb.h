@@ -67,6 +67,38 @@ void arb_clear(arb_t x);
 arb_ptr _arb_vec_init(slong n);
 void _arb_vec_clear(arb_ptr v, slong n);
 
+/* scratch arena for temporaries */
+
+typedef struct
+{
+    char ** block;
+    slong * block_size;
+    slong * block_used;
+    slong num_blocks;
+    slong cur;
+    arb_ptr * vec;
+    slong * vec_len;
+    slong num_vec;
+    slong alloc_vec;
+    slong * mark;
+    slong num_marks;
+    slong alloc_marks;
+}
+arb_arena_struct;
+
+typedef arb_arena_struct arb_arena_t[1];
+
+/* memory kept by an arena when the last mark is popped */
+#define ARB_ARENA_MAX_RETAIN 65536
+
+void arb_arena_init(arb_arena_t arena);
+void arb_arena_clear(arb_arena_t arena);
+void arb_arena_push(arb_arena_t arena);
+void arb_arena_pop(arb_arena_t arena);
+void * arb_arena_alloc(arb_arena_t arena, slong size);
+arb_ptr _arb_arena_vec_init(arb_arena_t arena, slong n);
+arb_arena_struct * _arb_arena_thread(void);
+
 ARB_INLINE arf_ptr arb_mid_ptr(arb_t z) { return arb_midref(z); }
 ARB_INLINE mag_ptr arb_rad_ptr(arb_t z) { return arb_radref(z); }
 
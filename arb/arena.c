@@ -0,0 +1,295 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "pthread.h"
+#include "arb.h"
+
+/*
+The arena is a stack of memory blocks. Blocks are never moved or shrunk
+while the arena is alive, so that pointers returned by arb_arena_alloc
+remain valid until the matching arb_arena_pop. When a request does not
+fit in the current block, we continue in the next block that is large
+enough, appending a new block (at least twice the size of the last one)
+if necessary.
+
+Vectors handed out by _arb_arena_vec_init are recorded so that
+arb_arena_pop can clear their entries; the limbs of the entries
+thus go back to the arf limb cache while the arb_structs themselves
+stay in the arena for the next push.
+
+A mark consists of the current block, the number of bytes used in it
+and the number of recorded vectors.
+
+When the last mark is popped, unused blocks beyond ARB_ARENA_MAX_RETAIN
+bytes in total are freed, so that a single large computation does not
+pin its peak scratch memory in long-lived (e.g. thread pool) threads.
+*/
+
+#define ARB_ARENA_ALIGN 16
+#define ARB_ARENA_MIN_BLOCK 4096
+
+static void
+_arb_arena_clear_entries(arb_ptr v, slong n)
+{
+    slong i;
+
+    for (i = 0; i < n; i++)
+    {
+        arb_clear(v + i);
+        arb_init(v + i);
+    }
+}
+
+void
+arb_arena_init(arb_arena_t arena)
+{
+    memset(arena, 0, sizeof(arb_arena_struct));
+}
+
+void
+arb_arena_clear(arb_arena_t arena)
+{
+    slong i;
+
+    while (arena->num_marks > 0)
+        arb_arena_pop(arena);
+
+    for (i = 0; i < arena->num_vec; i++)
+        _arb_arena_clear_entries(arena->vec[i], arena->vec_len[i]);
+
+    for (i = 0; i < arena->num_blocks; i++)
+        flint_free(arena->block[i]);
+
+    flint_free(arena->block);
+    flint_free(arena->block_size);
+    flint_free(arena->block_used);
+    flint_free(arena->vec);
+    flint_free(arena->vec_len);
+    flint_free(arena->mark);
+
+    arb_arena_init(arena);
+}
+
+void
+arb_arena_push(arb_arena_t arena)
+{
+    slong m = arena->num_marks;
+
+    if (3 * (m + 1) > arena->alloc_marks)
+    {
+        arena->alloc_marks = FLINT_MAX(3 * (m + 1), 2 * arena->alloc_marks);
+        arena->mark = flint_realloc(arena->mark,
+            arena->alloc_marks * sizeof(slong));
+    }
+
+    arena->mark[3 * m] = arena->cur;
+    arena->mark[3 * m + 1] = (arena->num_blocks == 0) ? 0 :
+        arena->block_used[arena->cur];
+    arena->mark[3 * m + 2] = arena->num_vec;
+    arena->num_marks = m + 1;
+}
+
+/* frees the trailing blocks beyond ARB_ARENA_MAX_RETAIN bytes; blocks
+   up to cur may hold data allocated outside any push and are kept */
+static void
+_arb_arena_trim(arb_arena_t arena)
+{
+    slong i, j, keep, total;
+
+    if (arena->num_blocks == 0)
+        return;
+
+    keep = (arena->block_used[arena->cur] == 0) ? arena->cur : arena->cur + 1;
+
+    total = 0;
+    for (i = 0; i < keep; i++)
+        total += arena->block_size[i];
+
+    for ( ; i < arena->num_blocks; i++)
+    {
+        if (total + arena->block_size[i] > ARB_ARENA_MAX_RETAIN)
+            break;
+        total += arena->block_size[i];
+    }
+
+    for (j = i; j < arena->num_blocks; j++)
+        flint_free(arena->block[j]);
+
+    arena->num_blocks = i;
+
+    if (arena->num_blocks == 0)
+    {
+        flint_free(arena->block);
+        flint_free(arena->block_size);
+        flint_free(arena->block_used);
+        arena->block = NULL;
+        arena->block_size = NULL;
+        arena->block_used = NULL;
+        arena->cur = 0;
+    }
+    else
+    {
+        arena->cur = FLINT_MIN(arena->cur, arena->num_blocks - 1);
+    }
+}
+
+void
+arb_arena_pop(arb_arena_t arena)
+{
+    slong m, i, cur, used, num_vec;
+
+    if (arena->num_marks == 0)
+    {
+        flint_printf("arb_arena_pop: no matching push\n");
+        flint_abort();
+    }
+
+    m = --arena->num_marks;
+    cur = arena->mark[3 * m];
+    used = arena->mark[3 * m + 1];
+    num_vec = arena->mark[3 * m + 2];
+
+    for (i = arena->num_vec - 1; i >= num_vec; i--)
+        _arb_arena_clear_entries(arena->vec[i], arena->vec_len[i]);
+
+    arena->num_vec = num_vec;
+
+    if (arena->num_blocks != 0)
+    {
+        for (i = cur + 1; i < arena->num_blocks; i++)
+            arena->block_used[i] = 0;
+
+        arena->block_used[cur] = used;
+        arena->cur = cur;
+
+        if (m == 0)
+            _arb_arena_trim(arena);
+    }
+}
+
+void *
+arb_arena_alloc(arb_arena_t arena, slong size)
+{
+    slong i;
+    char * ptr;
+
+    size = FLINT_MAX(size, 1);
+    size = (size + ARB_ARENA_ALIGN - 1) & ~(slong) (ARB_ARENA_ALIGN - 1);
+
+    if (arena->num_blocks == 0 ||
+        arena->block_used[arena->cur] + size > arena->block_size[arena->cur])
+    {
+        i = (arena->num_blocks == 0) ? 0 : arena->cur + 1;
+
+        for ( ; i < arena->num_blocks; i++)
+            if (arena->block_size[i] >= size)
+                break;
+
+        if (i == arena->num_blocks)
+        {
+            slong bsize = ARB_ARENA_MIN_BLOCK;
+
+            if (i != 0)
+                bsize = 2 * arena->block_size[i - 1];
+
+            bsize = FLINT_MAX(bsize, size);
+
+            arena->block = flint_realloc(arena->block, (i + 1) * sizeof(char *));
+            arena->block_size = flint_realloc(arena->block_size, (i + 1) * sizeof(slong));
+            arena->block_used = flint_realloc(arena->block_used, (i + 1) * sizeof(slong));
+
+            arena->block[i] = flint_malloc(bsize);
+            arena->block_size[i] = bsize;
+            arena->block_used[i] = 0;
+            arena->num_blocks = i + 1;
+        }
+
+        arena->cur = i;
+    }
+
+    ptr = arena->block[arena->cur] + arena->block_used[arena->cur];
+    arena->block_used[arena->cur] += size;
+
+    return ptr;
+}
+
+arb_ptr
+_arb_arena_vec_init(arb_arena_t arena, slong n)
+{
+    arb_ptr v;
+    slong i;
+
+    v = arb_arena_alloc(arena, n * sizeof(arb_struct));
+
+    for (i = 0; i < n; i++)
+        arb_init(v + i);
+
+    if (n > 0)
+    {
+        if (arena->num_vec == arena->alloc_vec)
+        {
+            arena->alloc_vec = FLINT_MAX(16, 2 * arena->alloc_vec);
+            arena->vec = flint_realloc(arena->vec,
+                arena->alloc_vec * sizeof(arb_ptr));
+            arena->vec_len = flint_realloc(arena->vec_len,
+                arena->alloc_vec * sizeof(slong));
+        }
+
+        arena->vec[arena->num_vec] = v;
+        arena->vec_len[arena->num_vec] = n;
+        arena->num_vec++;
+    }
+
+    return v;
+}
+
+/* thread-local arena */
+
+FLINT_TLS_PREFIX arb_arena_struct _arb_arena_tls;
+FLINT_TLS_PREFIX int _arb_arena_tls_registered = 0;
+
+static pthread_once_t _arb_arena_once = PTHREAD_ONCE_INIT;
+static pthread_key_t _arb_arena_key;
+
+static void
+_arb_arena_cleanup(void)
+{
+    arb_arena_clear(&_arb_arena_tls);
+    _arb_arena_tls_registered = 0;
+}
+
+static void
+_arb_arena_thread_exit(void * unused)
+{
+    _arb_arena_cleanup();
+}
+
+static void
+_arb_arena_init_once(void)
+{
+    pthread_key_create(&_arb_arena_key, _arb_arena_thread_exit);
+    flint_register_cleanup_function(_arb_arena_cleanup);
+}
+
+arb_arena_struct *
+_arb_arena_thread(void)
+{
+    if (!_arb_arena_tls_registered)
+    {
+        pthread_once(&_arb_arena_once, _arb_arena_init_once);
+        pthread_setspecific(_arb_arena_key, &_arb_arena_once);
+        _arb_arena_tls_registered = 1;
+    }
+
+    return &_arb_arena_tls;
+}
+
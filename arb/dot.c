@@ -378,6 +378,303 @@ _arb_dot_add_generic(mp_ptr sum, mp_ptr serr, mp_ptr tmp, mp_size_t sn,
     }
 }
 
+/* Adds the two-limb term (u3, u2, u1, u0) 2^(-shift), where u3 is aligned
+   with the top of the sum, to the 2-limb sum; 0 < shift < 2 * FLINT_BITS. */
+static __inline__ void
+_arb_dot_accum_sn2(mp_ptr sum, mp_limb_t * serr, mp_limb_t u3, mp_limb_t u2,
+    mp_limb_t u1, mp_limb_t u0, slong shift, int negative)
+{
+    if (shift < FLINT_BITS)
+    {
+        *serr += ((u2 << (FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
+        u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
+        u3 = (u3 >> shift);
+    }
+    else if (shift == FLINT_BITS)
+    {
+        *serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
+        u2 = u3;
+        u3 = 0;
+    }
+    else /* FLINT_BITS < shift < 2 * FLINT_BITS */
+    {
+        *serr += ((u3 << (2 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
+        u2 = (u3 >> (shift - FLINT_BITS));
+        u3 = 0;
+    }
+
+    if (negative)
+        sub_ddmmss(sum[1], sum[0], sum[1], sum[0], u3, u2);
+    else
+        add_ssaaaa(sum[1], sum[0], sum[1], sum[0], u3, u2);
+}
+
+/* The same for a 3-limb sum; 0 < shift < 3 * FLINT_BITS. */
+static __inline__ void
+_arb_dot_accum_sn3(mp_ptr sum, mp_limb_t * serr, mp_limb_t u3, mp_limb_t u2,
+    mp_limb_t u1, mp_limb_t u0, slong shift, int negative)
+{
+    if (shift < FLINT_BITS)
+    {
+        *serr += ((u1 << (FLINT_BITS - shift)) != 0) || (u0 != 0);
+        u1 = (u1 >> shift) | (u2 << (FLINT_BITS - shift));
+        u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
+        u3 = (u3 >> shift);
+    }
+    else if (shift == FLINT_BITS)
+    {
+        *serr += (u1 != 0) || (u0 != 0);
+        u1 = u2;
+        u2 = u3;
+        u3 = 0;
+    }
+    else if (shift < 2 * FLINT_BITS)
+    {
+        *serr += ((u2 << (2 * FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
+        u1 = (u3 << (2 * FLINT_BITS - shift)) | (u2 >> (shift - FLINT_BITS));
+        u2 = (u3 >> (shift - FLINT_BITS));
+        u3 = 0;
+    }
+    else if (shift == 2 * FLINT_BITS)
+    {
+        *serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
+        u1 = u3;
+        u2 = 0;
+        u3 = 0;
+    }
+    else  /* 2 * FLINT_BITS < shift < 3 * FLINT_BITS */
+    {
+        *serr += ((u3 << (3 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
+        u1 = (u3 >> (shift - 2 * FLINT_BITS));
+        u2 = 0;
+        u3 = 0;
+    }
+
+    if (negative)
+        sub_dddmmmsss(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
+    else
+        add_sssaaaaaa(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
+}
+
+/* Propagated error for a term with nonzero midpoints with top limbs
+   xtop and ytop: (xm+xr)(ym+yr) = xm ym + [xr ym + xm yr + xr yr]. */
+static __inline__ void
+_arb_dot_rad_term(uint64_t * srad, slong srad_exp,
+    mp_limb_t xtop, slong xexp, mag_srcptr xr,
+    mp_limb_t ytop, slong yexp, mag_srcptr yr)
+{
+    mp_limb_t xrad, yrad;
+    slong xrexp, yrexp;
+
+    xrad = MAG_MAN(xr);
+    yrad = MAG_MAN(yr);
+
+    if (xrad != 0 && yrad != 0)
+    {
+        xrexp = MAG_EXP(xr);
+        yrexp = MAG_EXP(yr);
+
+        RAD_ADDMUL(*srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
+        RAD_ADDMUL(*srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
+        RAD_ADDMUL(*srad, srad_exp, xrad, yrad, xrexp + yrexp);
+    }
+    else if (xrad != 0)
+    {
+        xrexp = MAG_EXP(xr);
+        RAD_ADDMUL(*srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
+    }
+    else if (yrad != 0)
+    {
+        yrexp = MAG_EXP(yr);
+        RAD_ADDMUL(*srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
+    }
+}
+
+/* Propagated error for a term where some midpoint is zero. */
+static __inline__ void
+_arb_dot_rad_term_zero(uint64_t * srad, slong srad_exp,
+    arf_srcptr xm, mag_srcptr xr, arf_srcptr ym, mag_srcptr yr)
+{
+    mp_limb_t xrad, yrad, xtop, ytop;
+    slong xexp, yexp, xrexp, yrexp;
+
+    xrad = MAG_MAN(xr);
+    yrad = MAG_MAN(yr);
+
+    xexp = ARF_EXP(xm);
+    yexp = ARF_EXP(ym);
+
+    xrexp = MAG_EXP(xr);
+    yrexp = MAG_EXP(yr);
+
+    /* (xm+xr)(ym+yr) = xm ym + [xm yr + ym xr + xr yr] */
+    if (yrad && !arf_is_special(xm))
+    {
+        ARF_GET_TOP_LIMB(xtop, xm);
+        RAD_ADDMUL(*srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
+    }
+
+    if (xrad && !arf_is_special(ym))
+    {
+        ARF_GET_TOP_LIMB(ytop, ym);
+        RAD_ADDMUL(*srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
+    }
+
+    if (xrad && yrad)
+    {
+        RAD_ADDMUL(*srad, srad_exp, xrad, yrad, xrexp + yrexp);
+    }
+}
+
+/*
+Specialized main loops for the most common low-precision cases: a 2-limb
+sum with single-limb midpoints, and a 3-limb sum with midpoints of at most
+two limbs. They avoid the per-term dispatch on the operand sizes of the
+general loop and process two terms per iteration so that the independent
+limb multiplications can overlap.
+*/
+
+static __inline__ void
+_arb_dot_term_1x1_sn2(mp_ptr sum, mp_limb_t * serr, uint64_t * srad,
+    slong srad_exp, slong sum_exp, arb_srcptr xi, arb_srcptr yi)
+{
+    arf_srcptr xm = arb_midref(xi), ym = arb_midref(yi);
+
+    if (!arf_is_special(xm) && !arf_is_special(ym))
+    {
+        mp_limb_t xtop, ytop, u3, u2;
+        slong xexp, yexp, shift;
+
+        xtop = ARF_NOPTR_D(xm)[0];
+        ytop = ARF_NOPTR_D(ym)[0];
+        xexp = ARF_EXP(xm);
+        yexp = ARF_EXP(ym);
+        shift = sum_exp - (xexp + yexp);
+
+        if (shift >= 2 * FLINT_BITS)
+        {
+            (*serr)++;
+        }
+        else
+        {
+            umul_ppmm(u3, u2, xtop, ytop);
+            _arb_dot_accum_sn2(sum, serr, u3, u2, 0, 0, shift,
+                ARF_SGNBIT(xm) ^ ARF_SGNBIT(ym));
+        }
+
+        if (MAG_MAN(arb_radref(xi)) != 0 || MAG_MAN(arb_radref(yi)) != 0)
+            _arb_dot_rad_term(srad, srad_exp, xtop, xexp, arb_radref(xi),
+                ytop, yexp, arb_radref(yi));
+    }
+    else
+    {
+        _arb_dot_rad_term_zero(srad, srad_exp, xm, arb_radref(xi), ym, arb_radref(yi));
+    }
+}
+
+static __inline__ void
+_arb_dot_term_2x2_sn3(mp_ptr sum, mp_limb_t * serr, uint64_t * srad,
+    slong srad_exp, slong sum_exp, arb_srcptr xi, arb_srcptr yi)
+{
+    arf_srcptr xm = arb_midref(xi), ym = arb_midref(yi);
+
+    if (!arf_is_special(xm) && !arf_is_special(ym))
+    {
+        mp_limb_t x1, x0, y1, y0, u3, u2, u1, u0;
+        slong xexp, yexp, shift;
+
+        /* a single limb is aligned with the top */
+        if (ARF_SIZE(xm) == 2)
+        {
+            x0 = ARF_NOPTR_D(xm)[0];
+            x1 = ARF_NOPTR_D(xm)[1];
+        }
+        else
+        {
+            x0 = 0;
+            x1 = ARF_NOPTR_D(xm)[0];
+        }
+
+        if (ARF_SIZE(ym) == 2)
+        {
+            y0 = ARF_NOPTR_D(ym)[0];
+            y1 = ARF_NOPTR_D(ym)[1];
+        }
+        else
+        {
+            y0 = 0;
+            y1 = ARF_NOPTR_D(ym)[0];
+        }
+
+        xexp = ARF_EXP(xm);
+        yexp = ARF_EXP(ym);
+        shift = sum_exp - (xexp + yexp);
+
+        if (shift >= 3 * FLINT_BITS)
+        {
+            (*serr)++;
+        }
+        else
+        {
+            nn_mul_2x2(u3, u2, u1, u0, x1, x0, y1, y0);
+            _arb_dot_accum_sn3(sum, serr, u3, u2, u1, u0, shift,
+                ARF_SGNBIT(xm) ^ ARF_SGNBIT(ym));
+        }
+
+        if (MAG_MAN(arb_radref(xi)) != 0 || MAG_MAN(arb_radref(yi)) != 0)
+            _arb_dot_rad_term(srad, srad_exp, x1, xexp, arb_radref(xi),
+                y1, yexp, arb_radref(yi));
+    }
+    else
+    {
+        _arb_dot_rad_term_zero(srad, srad_exp, xm, arb_radref(xi), ym, arb_radref(yi));
+    }
+}
+
+static void
+_arb_dot_main_1x1_sn2(mp_ptr sum, mp_limb_t * serr, uint64_t * srad,
+    slong srad_exp, slong sum_exp, arb_srcptr x, slong xstep,
+    arb_srcptr y, slong ystep, slong len)
+{
+    slong i;
+
+    for (i = 0; i + 1 < len; i += 2)
+    {
+        _arb_dot_term_1x1_sn2(sum, serr, srad, srad_exp, sum_exp,
+            x + i * xstep, y + i * ystep);
+        _arb_dot_term_1x1_sn2(sum, serr, srad, srad_exp, sum_exp,
+            x + (i + 1) * xstep, y + (i + 1) * ystep);
+    }
+
+    if (i < len)
+        _arb_dot_term_1x1_sn2(sum, serr, srad, srad_exp, sum_exp,
+            x + i * xstep, y + i * ystep);
+}
+
+static void
+_arb_dot_main_2x2_sn3(mp_ptr sum, mp_limb_t * serr, uint64_t * srad,
+    slong srad_exp, slong sum_exp, arb_srcptr x, slong xstep,
+    arb_srcptr y, slong ystep, slong len)
+{
+    slong i;
+
+    for (i = 0; i + 1 < len; i += 2)
+    {
+        _arb_dot_term_2x2_sn3(sum, serr, srad, srad_exp, sum_exp,
+            x + i * xstep, y + i * ystep);
+        _arb_dot_term_2x2_sn3(sum, serr, srad, srad_exp, sum_exp,
+            x + (i + 1) * xstep, y + (i + 1) * ystep);
+    }
+
+    if (i < len)
+        _arb_dot_term_2x2_sn3(sum, serr, srad, srad_exp, sum_exp,
+            x + i * xstep, y + i * ystep);
+}
+
+/* allow disabling the specialized loops from the test and profile code;
+   deliberately not declared in arb.h */
+ARB_DLL int arb_dot_fast_enabled = 1;
+
 void
 arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec)
 {
@@ -385,13 +682,13 @@ arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep,
     slong xexp, yexp, exp, max_exp, min_exp, sum_exp;
     slong xrexp, yrexp, srad_exp, max_rad_exp;
     int xnegative, ynegative, inexact;
-    mp_size_t xn, yn, sn, alloc;
+    mp_size_t xn, yn, sn, alloc, max_size;
     flint_bitcnt_t shift;
     arb_srcptr xi, yi;
     arf_srcptr xm, ym;
     mag_srcptr xr, yr;
     mp_limb_t xtop, ytop;
-    mp_limb_t xrad, yrad;
+    mp_limb_t xrad;
     mp_limb_t serr;   /* Sum over arithmetic errors */
     uint64_t srad;    /* Sum over propagated errors */
     mp_ptr tmp, sum;  /* Workspace */
@@ -431,6 +728,9 @@ arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep,
     /* Used to reduce the precision. */
     min_exp = WORD_MAX;
 
+    /* Largest number of limbs in a nonzero midpoint product term. */
+    max_size = 0;
+
     /* Account for the initial term. */
     if (initial != NULL)
     {
@@ -484,6 +784,8 @@ arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep,
                 yexp = ARF_EXP(ym);
 
                 max_exp = FLINT_MAX(max_exp, xexp + yexp);
+                max_size = FLINT_MAX(max_size, ARF_SIZE(xm));
+                max_size = FLINT_MAX(max_size, ARF_SIZE(ym));
                 nonzero++;
 
                 if (prec > 2 * FLINT_BITS)
@@ -647,270 +949,114 @@ arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep,
         }
     }
 
-    for (i = 0; i < len; i++)
+    if (arb_dot_fast_enabled && sn == 2 && max_size <= 1)
     {
-        xi = x + i * xstep;
-        yi = y + i * ystep;
-        xm = arb_midref(xi);
-        ym = arb_midref(yi);
-        xr = arb_radref(xi);
-        yr = arb_radref(yi);
-
-        /* The midpoints of x[i] and y[i] are both nonzero. */
-        if (!arf_is_special(xm) && !arf_is_special(ym))
+        _arb_dot_main_1x1_sn2(sum, &serr, &srad, srad_exp, sum_exp,
+            x, xstep, y, ystep, len);
+    }
+    else if (arb_dot_fast_enabled && sn == 3 && max_size <= 2)
+    {
+        _arb_dot_main_2x2_sn3(sum, &serr, &srad, srad_exp, sum_exp,
+            x, xstep, y, ystep, len);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
         {
-            xexp = ARF_EXP(xm);
-            xn = ARF_SIZE(xm);
-            xnegative = ARF_SGNBIT(xm);
-
-            yexp = ARF_EXP(ym);
-            yn = ARF_SIZE(ym);
-            ynegative = ARF_SGNBIT(ym);
-
-            exp = xexp + yexp;
-            shift = sum_exp - exp;
-
-            if (shift >= sn * FLINT_BITS)
-            {
-                /* We may yet need the top limbs for bounds. */
-                ARF_GET_TOP_LIMB(xtop, xm);
-                ARF_GET_TOP_LIMB(ytop, ym);
-                serr++;
-            }
-#if 0
-            else if (xn == 1 && yn == 1 && sn == 2 && shift < FLINT_BITS)  /* Fastest path. */
+            xi = x + i * xstep;
+            yi = y + i * ystep;
+            xm = arb_midref(xi);
+            ym = arb_midref(yi);
+            xr = arb_radref(xi);
+            yr = arb_radref(yi);
+
+            /* The midpoints of x[i] and y[i] are both nonzero. */
+            if (!arf_is_special(xm) && !arf_is_special(ym))
             {
-                mp_limb_t hi, lo, out;
-
-                xtop = ARF_NOPTR_D(xm)[0];
-                ytop = ARF_NOPTR_D(ym)[0];
-
-                umul_ppmm(hi, lo, xtop, ytop);
-
-                out = lo << (FLINT_BITS - shift);
-                lo = (lo >> shift) | (hi << (FLINT_BITS - shift));
-                hi = (hi >> shift);
-                serr += (out != 0);
+                xexp = ARF_EXP(xm);
+                xn = ARF_SIZE(xm);
+                xnegative = ARF_SGNBIT(xm);
 
-                if (xnegative ^ ynegative)
-                    sub_ddmmss(sum[1], sum[0], sum[1], sum[0], hi, lo);
-                else
-                    add_ssaaaa(sum[1], sum[0], sum[1], sum[0], hi, lo);
-            }
-            else if (xn == 2 && yn == 2 && shift < FLINT_BITS && sn <= 3)
-            {
-                mp_limb_t x1, x0, y1, y0;
-                mp_limb_t u3, u2, u1, u0;
-
-                x0 = ARF_NOPTR_D(xm)[0];
-                x1 = ARF_NOPTR_D(xm)[1];
-                y0 = ARF_NOPTR_D(ym)[0];
-                y1 = ARF_NOPTR_D(ym)[1];
-
-                xtop = x1;
-                ytop = y1;
-
-                nn_mul_2x2(u3, u2, u1, u0, x1, x0, y1, y0);
+                yexp = ARF_EXP(ym);
+                yn = ARF_SIZE(ym);
+                ynegative = ARF_SGNBIT(ym);
 
-                u0 = (u0 != 0) || ((u1 << (FLINT_BITS - shift)) != 0);
-                u1 = (u1 >> shift) | (u2 << (FLINT_BITS - shift));
-                u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
-                u3 = (u3 >> shift);
+                exp = xexp + yexp;
+                shift = sum_exp - exp;
 
-                if (sn == 2)
+                if (shift >= sn * FLINT_BITS)
                 {
-                    serr += (u0 || (u1 != 0));
-                    if (xnegative ^ ynegative)
-                        sub_ddmmss(sum[1], sum[0], sum[1], sum[0], u3, u2);
-                    else
-                        add_ssaaaa(sum[1], sum[0], sum[1], sum[0], u3, u2);
+                    /* We may yet need the top limbs for bounds. */
+                    ARF_GET_TOP_LIMB(xtop, xm);
+                    ARF_GET_TOP_LIMB(ytop, ym);
+                    serr++;
                 }
-                else
+                else if (xn <= 2 && yn <= 2 && sn <= 3)
                 {
-                    serr += u0;
-                    if (xnegative ^ ynegative)
-                        sub_dddmmmsss(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
-                    else
-                        add_sssaaaaaa(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
-                }
-            }
-#endif
-            else if (xn <= 2 && yn <= 2 && sn <= 3)
-            {
-                mp_limb_t x1, x0, y1, y0;
-                mp_limb_t u3, u2, u1, u0;
+                    mp_limb_t x1, x0, y1, y0;
+                    mp_limb_t u3, u2, u1, u0;
 
-                if (xn == 1 && yn == 1)
-                {
-                    xtop = ARF_NOPTR_D(xm)[0];
-                    ytop = ARF_NOPTR_D(ym)[0];
-                    umul_ppmm(u3, u2, xtop, ytop);
-                    u1 = u0 = 0;
-                }
-                else if (xn == 2 && yn == 2)
-                {
-                    x0 = ARF_NOPTR_D(xm)[0];
-                    x1 = ARF_NOPTR_D(xm)[1];
-                    y0 = ARF_NOPTR_D(ym)[0];
-                    y1 = ARF_NOPTR_D(ym)[1];
-                    xtop = x1;
-                    ytop = y1;
-                    nn_mul_2x2(u3, u2, u1, u0, x1, x0, y1, y0);
-                }
-                else if (xn == 1)
-                {
-                    x0 = ARF_NOPTR_D(xm)[0];
-                    y0 = ARF_NOPTR_D(ym)[0];
-                    y1 = ARF_NOPTR_D(ym)[1];
-                    xtop = x0;
-                    ytop = y1;
-                    nn_mul_2x1(u3, u2, u1, y1, y0, x0);
-                    u0 = 0;
-                }
-                else
-                {
-                    x0 = ARF_NOPTR_D(xm)[0];
-                    x1 = ARF_NOPTR_D(xm)[1];
-                    y0 = ARF_NOPTR_D(ym)[0];
-                    xtop = x1;
-                    ytop = y0;
-                    nn_mul_2x1(u3, u2, u1, x1, x0, y0);
-                    u0 = 0;
-                }
-
-                if (sn == 2)
-                {
-                    if (shift < FLINT_BITS)
+                    if (xn == 1 && yn == 1)
                     {
-                        serr += ((u2 << (FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
-                        u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
-                        u3 = (u3 >> shift);
+                        xtop = ARF_NOPTR_D(xm)[0];
+                        ytop = ARF_NOPTR_D(ym)[0];
+                        umul_ppmm(u3, u2, xtop, ytop);
+                        u1 = u0 = 0;
                     }
-                    else if (shift == FLINT_BITS)
+                    else if (xn == 2 && yn == 2)
                     {
-                        serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
-                        u2 = u3;
-                        u3 = 0;
+                        x0 = ARF_NOPTR_D(xm)[0];
+                        x1 = ARF_NOPTR_D(xm)[1];
+                        y0 = ARF_NOPTR_D(ym)[0];
+                        y1 = ARF_NOPTR_D(ym)[1];
+                        xtop = x1;
+                        ytop = y1;
+                        nn_mul_2x2(u3, u2, u1, u0, x1, x0, y1, y0);
                     }
-                    else /* FLINT_BITS < shift < 2 * FLINT_BITS */
+                    else if (xn == 1)
                     {
-                        serr += ((u3 << (2 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
-                        u2 = (u3 >> (shift - FLINT_BITS));
-                        u3 = 0;
+                        x0 = ARF_NOPTR_D(xm)[0];
+                        y0 = ARF_NOPTR_D(ym)[0];
+                        y1 = ARF_NOPTR_D(ym)[1];
+                        xtop = x0;
+                        ytop = y1;
+                        nn_mul_2x1(u3, u2, u1, y1, y0, x0);
+                        u0 = 0;
                     }
-
-                    if (xnegative ^ ynegative)
-                        sub_ddmmss(sum[1], sum[0], sum[1], sum[0], u3, u2);
                     else
-                        add_ssaaaa(sum[1], sum[0], sum[1], sum[0], u3, u2);
-                }
-                else if (sn == 3)
-                {
-                    if (shift < FLINT_BITS)
-                    {
-                        serr += ((u1 << (FLINT_BITS - shift)) != 0) || (u0 != 0);
-                        u1 = (u1 >> shift) | (u2 << (FLINT_BITS - shift));
-                        u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
-                        u3 = (u3 >> shift);
-                    }
-                    else if (shift == FLINT_BITS)
                     {
-                        serr += (u1 != 0) || (u0 != 0);
-                        u1 = u2;
-                        u2 = u3;
-                        u3 = 0;
-                    }
-                    else if (shift < 2 * FLINT_BITS)
-                    {
-                        serr += ((u2 << (2 * FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
-                        u1 = (u3 << (2 * FLINT_BITS - shift)) | (u2 >> (shift - FLINT_BITS));
-                        u2 = (u3 >> (shift - FLINT_BITS));
-                        u3 = 0;
-                    }
-                    else if (shift == 2 * FLINT_BITS)
-                    {
-                        serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
-                        u1 = u3;
-                        u2 = 0;
-                        u3 = 0;
-                    }
-                    else  /* 2 * FLINT_BITS < shift < 3 * FLINT_BITS */
-                    {
-                        serr += ((u3 << (3 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
-                        u1 = (u3 >> (shift - 2 * FLINT_BITS));
-                        u2 = 0;
-                        u3 = 0;
+                        x0 = ARF_NOPTR_D(xm)[0];
+                        x1 = ARF_NOPTR_D(xm)[1];
+                        y0 = ARF_NOPTR_D(ym)[0];
+                        xtop = x1;
+                        ytop = y0;
+                        nn_mul_2x1(u3, u2, u1, x1, x0, y0);
+                        u0 = 0;
                     }
 
-                    if (xnegative ^ ynegative)
-                        sub_dddmmmsss(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
+                    if (sn == 2)
+                        _arb_dot_accum_sn2(sum, &serr, u3, u2, u1, u0, shift, xnegative ^ ynegative);
                     else
-                        add_sssaaaaaa(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
+                        _arb_dot_accum_sn3(sum, &serr, u3, u2, u1, u0, shift, xnegative ^ ynegative);
                 }
-            }
-            else
-            {
-                mp_srcptr xptr, yptr;
-
-                xptr = (xn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(xm) : ARF_PTR_D(xm);
-                yptr = (yn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(ym) : ARF_PTR_D(ym);
-
-                xtop = xptr[xn - 1];
-                ytop = yptr[yn - 1];
-
-                _arb_dot_addmul_generic(sum, &serr, tmp, sn, xptr, xn, yptr, yn, xnegative ^ ynegative, shift);
-            }
-
-            xrad = MAG_MAN(xr);
-            yrad = MAG_MAN(yr);
-
-            if (xrad != 0 && yrad != 0)
-            {
-                xrexp = MAG_EXP(xr);
-                yrexp = MAG_EXP(yr);
-
-                RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
-                RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
-                RAD_ADDMUL(srad, srad_exp, xrad, yrad, xrexp + yrexp);
-            }
-            else if (xrad != 0)
-            {
-                xrexp = MAG_EXP(xr);
-                RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
-            }
-            else if (yrad != 0)
-            {
-                yrexp = MAG_EXP(yr);
-                RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
-            }
-        }
-        else
-        {
-            xrad = MAG_MAN(xr);
-            yrad = MAG_MAN(yr);
+                else
+                {
+                    mp_srcptr xptr, yptr;
 
-            xexp = ARF_EXP(xm);
-            yexp = ARF_EXP(ym);
+                    xptr = (xn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(xm) : ARF_PTR_D(xm);
+                    yptr = (yn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(ym) : ARF_PTR_D(ym);
 
-            xrexp = MAG_EXP(xr);
-            yrexp = MAG_EXP(yr);
+                    xtop = xptr[xn - 1];
+                    ytop = yptr[yn - 1];
 
-            /* (xm+xr)(ym+yr) = xm ym + [xm yr + ym xr + xr yr] */
-            if (yrad && !arf_is_special(xm))
-            {
-                ARF_GET_TOP_LIMB(xtop, xm);
-                RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
-            }
+                    _arb_dot_addmul_generic(sum, &serr, tmp, sn, xptr, xn, yptr, yn, xnegative ^ ynegative, shift);
+                }
 
-            if (xrad && !arf_is_special(ym))
-            {
-                ARF_GET_TOP_LIMB(ytop, ym);
-                RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
+                _arb_dot_rad_term(&srad, srad_exp, xtop, xexp, xr, ytop, yexp, yr);
             }
-
-            if (xrad && yrad)
+            else
             {
-                RAD_ADDMUL(srad, srad_exp, xrad, yrad, xrexp + yrexp);
+                _arb_dot_rad_term_zero(&srad, srad_exp, xm, xr, ym, yr);
             }
         }
     }
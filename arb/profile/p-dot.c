@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+#include "flint/profiler.h"
+
+/* defined in arb/dot.c, not part of the public interface */
+ARB_DLL extern int arb_dot_fast_enabled;
+
+/* Compares the specialized one- and two-limb loops in arb_dot with the
+   general code, for exact and inexact input. */
+int main(void)
+{
+    slong len_tab[4] = { 4, 16, 100, 1000 };
+    slong prec_tab[3] = { 64, 128, 256 };
+    arb_ptr x, y;
+    arb_t s;
+    flint_rand_t state;
+    timeit_t timer;
+    slong i, j, k, r, len, prec, reps;
+    int fast, exact;
+    double t[2];
+
+    flint_randinit(state);
+    arb_init(s);
+
+    for (exact = 1; exact >= 0; exact--)
+    {
+        flint_printf("%s input\n", exact ? "exact" : "inexact");
+
+        for (j = 0; j < 3; j++)
+        {
+            prec = prec_tab[j];
+
+            for (k = 0; k < 4; k++)
+            {
+                len = len_tab[k];
+                reps = 10000000 / len;
+
+                x = _arb_vec_init(len);
+                y = _arb_vec_init(len);
+
+                for (i = 0; i < len; i++)
+                {
+                    arb_urandom(x + i, state, prec);
+                    arb_urandom(y + i, state, prec);
+
+                    if (!exact)
+                    {
+                        mag_set_ui_2exp_si(arb_radref(x + i), 1, -prec);
+                        mag_set_ui_2exp_si(arb_radref(y + i), 1, -prec);
+                    }
+                }
+
+                for (fast = 0; fast <= 1; fast++)
+                {
+                    arb_dot_fast_enabled = fast;
+
+                    timeit_start(timer);
+                    for (r = 0; r < reps; r++)
+                        arb_dot(s, NULL, 0, x, 1, y, 1, len, prec);
+                    timeit_stop(timer);
+
+                    t[fast] = (double) timer->wall;
+                }
+
+                flint_printf("prec = %4wd  len = %5wd   generic: %8.1f ms   fast: %8.1f ms"
+                    "   speedup %.2f\n", prec, len, t[0], t[1], t[0] / t[1]);
+
+                _arb_vec_clear(x, len);
+                _arb_vec_clear(y, len);
+            }
+        }
+
+        flint_printf("\n");
+    }
+
+    arb_dot_fast_enabled = 1;
+    arb_clear(s);
+    flint_randclear(state);
+    flint_cleanup();
+    return 0;
+}
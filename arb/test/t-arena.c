@@ -0,0 +1,137 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+
+/* allocates nested temporaries, fills them with values that depend
+   on the depth and checks that they survive inner pushes and pops */
+static void
+check_rec(arb_arena_t arena, flint_rand_t state, slong depth)
+{
+    arb_ptr v, w;
+    slong * raw;
+    slong i, n, m;
+
+    arb_arena_push(arena);
+
+    n = n_randint(state, 100);
+    m = n_randint(state, 2000);
+
+    v = _arb_arena_vec_init(arena, n);
+    raw = arb_arena_alloc(arena, m * sizeof(slong));
+    w = _arb_arena_vec_init(arena, n);
+
+    for (i = 0; i < n; i++)
+    {
+        if (!arb_is_zero(v + i) || !arb_is_exact(v + i) ||
+            !arb_is_zero(w + i) || !arb_is_exact(w + i))
+        {
+            flint_printf("FAIL (init)\n\n");
+            flint_abort();
+        }
+
+        arb_set_si(v + i, depth);
+        arb_const_pi(w + i, 64 + n_randint(state, 1000));
+    }
+
+    for (i = 0; i < m; i++)
+        raw[i] = depth + i;
+
+    if (depth < 5 && n_randint(state, 2))
+        check_rec(arena, state, depth + 1);
+
+    for (i = 0; i < n; i++)
+    {
+        if (!arb_equal_si(v + i, depth) || !arb_contains_si(w + i, 3)
+            || arb_contains_si(w + i, 4))
+        {
+            flint_printf("FAIL (value)\n\n");
+            flint_abort();
+        }
+    }
+
+    for (i = 0; i < m; i++)
+    {
+        if (raw[i] != depth + i)
+        {
+            flint_printf("FAIL (raw)\n\n");
+            flint_abort();
+        }
+    }
+
+    arb_arena_pop(arena);
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+    arb_arena_t arena;
+
+    flint_printf("arena....");
+    fflush(stdout);
+
+    flint_randinit(state);
+    arb_arena_init(arena);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        if (n_randint(state, 2))
+            check_rec(arena, state, 0);
+        else
+            check_rec(_arb_arena_thread(), state, 0);
+
+        if (n_randint(state, 100) == 0)
+        {
+            /* clearing with outstanding marks */
+            arb_arena_push(arena);
+            _arb_arena_vec_init(arena, 10);
+            arb_arena_clear(arena);
+        }
+    }
+
+    /* large temporaries are released when the last mark is popped */
+    {
+        arb_arena_struct * thread_arena = _arb_arena_thread();
+        slong i, total;
+        arb_ptr v;
+
+        arb_arena_push(thread_arena);
+        arb_arena_alloc(thread_arena, 100);
+        arb_arena_push(thread_arena);
+        v = _arb_arena_vec_init(thread_arena, 100000);
+        arb_const_pi(v + 99999, 1000);
+        arb_arena_alloc(thread_arena, 10 * ARB_ARENA_MAX_RETAIN);
+        arb_arena_pop(thread_arena);
+        arb_arena_pop(thread_arena);
+
+        total = 0;
+        for (i = 0; i < thread_arena->num_blocks; i++)
+            total += thread_arena->block_size[i];
+
+        if (total > ARB_ARENA_MAX_RETAIN)
+        {
+            flint_printf("FAIL (retain)\n\n");
+            flint_printf("total = %wd\n\n", total);
+            flint_abort();
+        }
+
+        /* the arena remains usable */
+        check_rec(thread_arena, state, 0);
+    }
+
+    arb_arena_clear(arena);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
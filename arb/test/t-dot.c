@@ -11,6 +11,9 @@
 
 #include "arb.h"
 
+/* defined in arb/dot.c, not part of the public interface */
+ARB_DLL extern int arb_dot_fast_enabled;
+
 int main()
 {
     slong iter;
@@ -35,7 +38,14 @@ int main()
         else
             len = n_randint(state, 3);
 
-        if (n_randint(state, 10) != 0 || len > 10)
+        if (n_randint(state, 4) == 0)
+        {
+            /* exercise the one- and two-limb loops */
+            prec = 2 + n_randint(state, 130);
+            xbits = 2 + n_randint(state, 130);
+            ybits = 2 + n_randint(state, 130);
+        }
+        else if (n_randint(state, 10) != 0 || len > 10)
         {
             prec = 2 + n_randint(state, 500);
             xbits = 2 + n_randint(state, 500);
@@ -148,6 +158,28 @@ int main()
             flint_abort();
         }
 
+        /* The specialized loops must agree with the general code. */
+        if (n_randint(state, 4) == 0)
+        {
+            arb_dot_fast_enabled = 0;
+
+            arb_dot(s2, initial ? z : NULL, subtract,
+                revx ? (x + len - 1) : x, revx ? -1 : 1,
+                revy ? (y + len - 1) : y, revy ? -1 : 1,
+                len, prec);
+
+            arb_dot_fast_enabled = 1;
+
+            if (!arb_equal(s1, s2))
+            {
+                flint_printf("FAIL (fast path)\n\n");
+                flint_printf("iter = %wd, len = %wd, prec = %wd, ebits = %wd\n\n", iter, len, prec, ebits);
+                flint_printf("s1 = "); arb_printn(s1, 100, ARB_STR_MORE); flint_printf("\n\n");
+                flint_printf("s2 = "); arb_printn(s2, 100, ARB_STR_MORE); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
         /* With the fast algorithm, we expect identical results when
            reversing the vectors. */
         if (ebits <= 12)
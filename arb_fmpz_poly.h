@@ -49,6 +49,8 @@ void arb_fmpz_poly_evaluate_arb(arb_t res, const fmpz_poly_t f, const arb_t a, s
 void arb_fmpz_poly_deflate(fmpz_poly_t result, const fmpz_poly_t input, ulong deflation);
 ulong arb_fmpz_poly_deflation(const fmpz_poly_t input);
 
+int arb_fmpz_poly_complex_roots_double(acb_ptr roots, const fmpz_poly_t poly, slong maxiter);
+
 void arb_fmpz_poly_complex_roots(acb_ptr roots, const fmpz_poly_t poly, int flags, slong target_prec);
 
 ARB_FMPZ_POLY_INLINE
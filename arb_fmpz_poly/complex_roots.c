@@ -12,6 +12,9 @@
 #include "arb_fmpz_poly.h"
 #include "flint/profiler.h"
 
+/* use the double precision pre-solve from this degree */
+#define DOUBLE_PRESOLVE_MIN_DEG 8
+
 static int check_accuracy(acb_ptr vec, slong len, slong prec)
 {
     slong i;
@@ -55,7 +58,7 @@ arb_fmpz_poly_complex_roots(acb_ptr roots, const fmpz_poly_t poly, int flags, sl
     acb_poly_t cpoly, cpoly_deflated;
     fmpz_poly_t poly_deflated;
     acb_ptr roots_deflated;
-    int removed_zero;
+    int removed_zero, presolve;
 
     if (fmpz_poly_degree(poly) < 1)
         return;
@@ -87,6 +90,32 @@ arb_fmpz_poly_complex_roots(acb_ptr roots, const fmpz_poly_t poly, int flags, sl
        as scratch space */
     roots_deflated = _acb_vec_init(deg);
 
+    /* approximate the roots in double precision; if they converged and
+       appear to be well separated, the multiprecision iteration only
+       needs to refine and certify them */
+    presolve = -1;
+    if (deg_deflated >= DOUBLE_PRESOLVE_MIN_DEG)
+    {
+        if (flags & ARB_FMPZ_POLY_ROOTS_VERBOSE)
+        {
+            TIMEIT_ONCE_START
+            flint_printf("double: ");
+            presolve = arb_fmpz_poly_complex_roots_double(roots_deflated,
+                poly_deflated, 0);
+            flint_printf("%s | ", presolve == 1 ? "separated" :
+                (presolve == 0 ? "not separated" : "failed"));
+            TIMEIT_ONCE_STOP
+        }
+        else
+        {
+            presolve = arb_fmpz_poly_complex_roots_double(roots_deflated,
+                poly_deflated, 0);
+        }
+
+        if (presolve == 1)
+            initial_prec = 64;
+    }
+
     for (prec = initial_prec; ; prec *= 2)
     {
         acb_poly_set_fmpz_poly(cpoly_deflated, poly_deflated, prec);
@@ -97,14 +126,16 @@ arb_fmpz_poly_complex_roots(acb_ptr roots, const fmpz_poly_t poly, int flags, sl
             TIMEIT_ONCE_START
             flint_printf("prec=%wd: ", prec);
             isolated = acb_poly_find_roots(roots_deflated, cpoly_deflated,
-                prec == initial_prec ? NULL : roots_deflated, maxiter, prec);
+                (prec == initial_prec && presolve == -1) ? NULL : roots_deflated,
+                maxiter, prec);
             flint_printf("%wd isolated roots | ", isolated);
             TIMEIT_ONCE_STOP
         }
         else
         {
             isolated = acb_poly_find_roots(roots_deflated, cpoly_deflated,
-                prec == initial_prec ? NULL : roots_deflated, maxiter, prec);
+                (prec == initial_prec && presolve == -1) ? NULL : roots_deflated,
+                maxiter, prec);
         }
 
         if (isolated == deg_deflated)
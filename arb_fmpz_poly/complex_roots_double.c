@@ -0,0 +1,438 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include <float.h>
+#include <stdlib.h>
+#include "flint/thread_support.h"
+#include "arb_fmpz_poly.h"
+
+/*
+Approximate roots in double precision using the Aberth-Ehrlich
+iteration. The variable is scaled by a power of two so that the
+geometric mean of the absolute values of the roots is about 1, and the
+coefficients are scaled so that the largest is about 1. The values at
+points outside the closed unit disc are computed from the reversed
+polynomial in 1/z, so that Horner's rule never overflows.
+As in _acb_poly_refine_roots_aberth, all corrections of a step are
+computed before any of them is applied, so the result does not depend
+on the number of threads, and converged roots are frozen.
+*/
+
+#define DOUBLE_ROOTS_CHUNK 16
+
+/* freeze a root when its correction is below this many ulps */
+#define DOUBLE_ROOTS_FREEZE_ULPS 4.0
+
+/* q = a / b, avoiding overflow (Smith's algorithm) */
+static void
+_d_cdiv(double * qr, double * qi, double ar, double ai, double br, double bi)
+{
+    double r, t;
+
+    if (fabs(br) >= fabs(bi))
+    {
+        r = bi / br;
+        t = br + bi * r;
+        *qr = (ar + ai * r) / t;
+        *qi = (ai - ar * r) / t;
+    }
+    else
+    {
+        r = br / bi;
+        t = br * r + bi;
+        *qr = (ar * r + ai) / t;
+        *qi = (ai * r - ar) / t;
+    }
+}
+
+/* (p, dp) = (f(z), f'(z)) */
+static void
+_d_horner2(double * pr, double * pi, double * dr, double * di,
+    const double * f, slong len, double zr, double zi)
+{
+    double ur, ui, vr, vi, t;
+    slong k;
+
+    ur = f[len - 1];
+    ui = 0.0;
+    vr = vi = 0.0;
+
+    for (k = len - 2; k >= 0; k--)
+    {
+        t = vr * zr - vi * zi + ur;
+        vi = vr * zi + vi * zr + ui;
+        vr = t;
+
+        t = ur * zr - ui * zi + f[k];
+        ui = ur * zi + ui * zr;
+        ur = t;
+    }
+
+    *pr = ur; *pi = ui;
+    *dr = vr; *di = vi;
+}
+
+/* Newton correction p(z) / p'(z); returns 0 if it is not finite */
+static int
+_d_newton(double * nr, double * ni, const double * f, const double * frev,
+    slong len, double zr, double zi)
+{
+    double pr, pi, dr, di, wr, wi, tr, ti;
+    slong deg = len - 1;
+
+    if (zr * zr + zi * zi <= 1.0)
+    {
+        _d_horner2(&pr, &pi, &dr, &di, f, len, zr, zi);
+
+        if (dr == 0.0 && di == 0.0)
+            return 0;
+
+        _d_cdiv(nr, ni, pr, pi, dr, di);
+    }
+    else
+    {
+        /* p(z) = z^n r(w), p'(z) = z^(n-1) (n r(w) - w r'(w)), w = 1/z */
+        _d_cdiv(&wr, &wi, 1.0, 0.0, zr, zi);
+        _d_horner2(&pr, &pi, &dr, &di, frev, len, wr, wi);
+
+        tr = deg * pr - (wr * dr - wi * di);
+        ti = deg * pi - (wr * di + wi * dr);
+
+        if (tr == 0.0 && ti == 0.0)
+            return 0;
+
+        _d_cdiv(&wr, &wi, pr, pi, tr, ti);
+        *nr = zr * wr - zi * wi;
+        *ni = zr * wi + zi * wr;
+    }
+
+    /* also catches NaN */
+    return (fabs(*nr) <= DBL_MAX && fabs(*ni) <= DBL_MAX);
+}
+
+typedef struct
+{
+    double * cr;
+    double * ci;
+    double * nr;
+    double * ni;
+    int * ok;
+    const double * zr;
+    const double * zi;
+    const double * f;
+    const double * frev;
+    const slong * active;
+    slong nactive;
+    slong len;
+}
+_double_roots_work_t;
+
+static void
+_double_roots_worker(slong c, _double_roots_work_t * w)
+{
+    slong k, k1, i, j, deg = w->len - 1;
+    double nr, ni, sr, si, dr, di, tr, ti;
+
+    k1 = FLINT_MIN((c + 1) * DOUBLE_ROOTS_CHUNK, w->nactive);
+
+    for (k = c * DOUBLE_ROOTS_CHUNK; k < k1; k++)
+    {
+        i = w->active[k];
+
+        w->ok[k] = _d_newton(&nr, &ni, w->f, w->frev, w->len, w->zr[i], w->zi[i]);
+        w->nr[k] = nr;
+        w->ni[k] = ni;
+
+        if (!w->ok[k])
+            continue;
+
+        /* s = sum_{j != i} 1 / (z_i - z_j) */
+        sr = si = 0.0;
+        for (j = 0; j < deg; j++)
+        {
+            if (j != i)
+            {
+                dr = w->zr[i] - w->zr[j];
+                di = w->zi[i] - w->zi[j];
+
+                if (dr != 0.0 || di != 0.0)
+                {
+                    _d_cdiv(&tr, &ti, 1.0, 0.0, dr, di);
+                    sr += tr;
+                    si += ti;
+                }
+            }
+        }
+
+        /* correction n / (1 - n s) */
+        tr = 1.0 - (nr * sr - ni * si);
+        ti = -(nr * si + ni * sr);
+
+        if (tr == 0.0 && ti == 0.0)
+        {
+            w->cr[k] = nr;
+            w->ci[k] = ni;
+        }
+        else
+        {
+            _d_cdiv(w->cr + k, w->ci + k, nr, ni, tr, ti);
+        }
+
+        w->ok[k] = (fabs(w->cr[k]) <= DBL_MAX && fabs(w->ci[k]) <= DBL_MAX);
+    }
+}
+
+typedef struct
+{
+    double left;
+    double right;
+    double re;
+    double im;
+    double rad;
+}
+_double_disc_t;
+
+static int
+_double_disc_cmp(const void * a, const void * b)
+{
+    double x = ((const _double_disc_t *) a)->left;
+    double y = ((const _double_disc_t *) b)->left;
+
+    return (x < y) ? -1 : (x > y);
+}
+
+/* checks that the discs are pairwise disjoint, sweeping by left edge */
+static int
+_double_discs_disjoint(_double_disc_t * D, slong n)
+{
+    slong i, j;
+    double dr, di;
+
+    qsort(D, n, sizeof(_double_disc_t), _double_disc_cmp);
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = i + 1; j < n && D[j].left <= D[i].right; j++)
+        {
+            dr = D[i].re - D[j].re;
+            di = D[i].im - D[j].im;
+
+            if (sqrt(dr * dr + di * di) <= D[i].rad + D[j].rad)
+                return 0;
+        }
+    }
+
+    return 1;
+}
+
+int
+arb_fmpz_poly_complex_roots_double(acb_ptr roots, const fmpz_poly_t poly, slong maxiter)
+{
+    _double_roots_work_t work;
+    _double_disc_t * D;
+    double *f, *frev, *zr, *zi, *cr, *ci, *nr, *ni, *m;
+    slong *e, *active;
+    int *ok, *frozen;
+    slong i, k, deg, len, sigma, emax, iter, nactive, nchunks;
+    double l0, ln, theta, t;
+    int result;
+
+    len = poly->length;
+    deg = len - 1;
+
+    if (deg < 1)
+        return 1;
+
+    f = flint_malloc(sizeof(double) * len);
+    frev = flint_malloc(sizeof(double) * len);
+    m = flint_malloc(sizeof(double) * len);
+    e = flint_malloc(sizeof(slong) * len);
+
+    for (k = 0; k < len; k++)
+        m[k] = fmpz_get_d_2exp(e + k, poly->coeffs + k);
+
+    /* x = 2^sigma y, with sigma ~ log2 |a_0 / a_n| / n */
+    if (m[0] != 0.0)
+    {
+        l0 = e[0] + log(fabs(m[0])) * 1.4426950408889634;
+        ln = e[deg] + log(fabs(m[deg])) * 1.4426950408889634;
+        sigma = (slong) floor((l0 - ln) / deg + 0.5);
+    }
+    else
+    {
+        sigma = 0;
+    }
+
+    emax = WORD_MIN;
+    for (k = 0; k < len; k++)
+    {
+        e[k] += k * sigma;
+        if (m[k] != 0.0)
+            emax = FLINT_MAX(emax, e[k]);
+    }
+
+    for (k = 0; k < len; k++)
+    {
+        if (m[k] == 0.0 || e[k] - emax < -2000)
+            f[k] = 0.0;
+        else
+            f[k] = ldexp(m[k], (int) (e[k] - emax));
+        frev[deg - k] = f[k];
+    }
+
+    /* the roots would not fit in the double range after scaling */
+    if (f[deg] == 0.0 || (m[0] != 0.0 && f[0] == 0.0))
+    {
+        flint_free(f);
+        flint_free(frev);
+        flint_free(m);
+        flint_free(e);
+        return -1;
+    }
+
+    zr = flint_malloc(sizeof(double) * deg);
+    zi = flint_malloc(sizeof(double) * deg);
+    cr = flint_malloc(sizeof(double) * deg);
+    ci = flint_malloc(sizeof(double) * deg);
+    nr = flint_malloc(sizeof(double) * deg);
+    ni = flint_malloc(sizeof(double) * deg);
+    ok = flint_malloc(sizeof(int) * deg);
+    frozen = flint_calloc(deg, sizeof(int));
+    active = flint_malloc(sizeof(slong) * deg);
+
+    /* initial values on the unit circle, rotated away from the real axis */
+    for (i = 0; i < deg; i++)
+    {
+        theta = 2 * 3.141592653589793 * (i + 0.25) / deg + 0.4;
+        zr[i] = cos(theta);
+        zi[i] = sin(theta);
+    }
+
+    if (maxiter <= 0)
+        maxiter = 200 + deg / 16;
+
+    result = 1;
+
+    work.cr = cr;
+    work.ci = ci;
+    work.nr = nr;
+    work.ni = ni;
+    work.ok = ok;
+    work.zr = zr;
+    work.zi = zi;
+    work.f = f;
+    work.frev = frev;
+    work.active = active;
+    work.len = len;
+
+    for (iter = 0; iter < maxiter; iter++)
+    {
+        for (i = nactive = 0; i < deg; i++)
+            if (!frozen[i])
+                active[nactive++] = i;
+
+        if (nactive == 0)
+            break;
+
+        work.nactive = nactive;
+        nchunks = (nactive + DOUBLE_ROOTS_CHUNK - 1) / DOUBLE_ROOTS_CHUNK;
+
+        if (nchunks > 1 && flint_get_num_threads() > 1)
+            flint_parallel_do((do_func_t) _double_roots_worker, &work,
+                nchunks, -1, FLINT_PARALLEL_DYNAMIC);
+        else
+            for (k = 0; k < nchunks; k++)
+                _double_roots_worker(k, &work);
+
+        for (k = 0; k < nactive; k++)
+        {
+            if (!ok[k])
+            {
+                result = -1;
+                break;
+            }
+
+            i = active[k];
+            zr[i] -= cr[k];
+            zi[i] -= ci[k];
+
+            t = FLINT_MAX(fabs(zr[i]), fabs(zi[i]));
+            if (FLINT_MAX(fabs(cr[k]), fabs(ci[k])) <= DOUBLE_ROOTS_FREEZE_ULPS * DBL_EPSILON * t)
+                frozen[i] = 1;
+        }
+
+        if (result == -1)
+            break;
+    }
+
+    if (result != -1)
+    {
+        /* every root must have converged */
+        for (i = 0; i < deg; i++)
+            if (!frozen[i])
+                result = 0;
+
+        /* cheap clustering check: the approximate inclusion discs of
+           radius n |p(z) / p'(z)|, enlarged by the rounding error,
+           must be disjoint */
+        if (result == 1)
+        {
+            D = flint_malloc(sizeof(_double_disc_t) * deg);
+
+            for (i = 0; i < deg && result == 1; i++)
+            {
+                if (!_d_newton(nr, ni, f, frev, len, zr[i], zi[i]))
+                {
+                    result = 0;
+                    break;
+                }
+
+                t = FLINT_MAX(fabs(zr[i]), fabs(zi[i]));
+                D[i].re = zr[i];
+                D[i].im = zi[i];
+                D[i].rad = deg * (sqrt(nr[0] * nr[0] + ni[0] * ni[0])
+                    + 16 * DBL_EPSILON * t);
+                D[i].left = zr[i] - D[i].rad;
+                D[i].right = zr[i] + D[i].rad;
+            }
+
+            if (result == 1 && !_double_discs_disjoint(D, deg))
+                result = 0;
+
+            flint_free(D);
+        }
+
+        for (i = 0; i < deg; i++)
+        {
+            acb_zero(roots + i);
+            arf_set_d(arb_midref(acb_realref(roots + i)), zr[i]);
+            arf_set_d(arb_midref(acb_imagref(roots + i)), zi[i]);
+            acb_mul_2exp_si(roots + i, roots + i, sigma);
+        }
+    }
+
+    flint_free(f);
+    flint_free(frev);
+    flint_free(m);
+    flint_free(e);
+    flint_free(zr);
+    flint_free(zi);
+    flint_free(cr);
+    flint_free(ci);
+    flint_free(nr);
+    flint_free(ni);
+    flint_free(ok);
+    flint_free(frozen);
+    flint_free(active);
+
+    return result;
+}
@@ -0,0 +1,236 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_fmpz_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("complex_roots_double....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* x^n - 2^e: well-conditioned roots far from the unit circle */
+    for (iter = 0; iter < 200 * arb_test_multiplier(); iter++)
+    {
+        fmpz_poly_t f;
+        acb_ptr roots;
+        acb_t w;
+        mag_t err, tol;
+        slong i, j, n, e;
+        int result;
+
+        n = 8 + n_randint(state, 150);
+        e = n_randint(state, 4000);
+        if (n_randint(state, 2))
+            e = -e;
+
+        fmpz_poly_init(f);
+        acb_init(w);
+        mag_init(err);
+        mag_init(tol);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        /* 2^e x^n - 1 if e < 0 */
+        fmpz_poly_set_coeff_si(f, 0, -1);
+        fmpz_poly_set_coeff_ui(f, n, 1);
+        if (e >= 0)
+            fmpz_mul_2exp(f->coeffs, f->coeffs, e);
+        else
+            fmpz_mul_2exp(f->coeffs + n, f->coeffs + n, -e);
+
+        roots = _acb_vec_init(n);
+
+        result = arb_fmpz_poly_complex_roots_double(roots, f, 0);
+
+        if (result != 1)
+        {
+            flint_printf("FAIL (result)\n");
+            flint_printf("n = %wd, e = %wd, result = %d\n", n, e, result);
+            flint_abort();
+        }
+
+        /* z^n 2^-e = 1 */
+        mag_set_d(tol, 1e-8);
+        for (i = 0; i < n; i++)
+        {
+            acb_pow_ui(w, roots + i, n, 64);
+            acb_mul_2exp_si(w, w, -e);
+            acb_sub_ui(w, w, 1, 64);
+            acb_get_mag(err, w);
+
+            if (mag_cmp(err, tol) > 0)
+            {
+                flint_printf("FAIL (accuracy)\n");
+                flint_printf("n = %wd, e = %wd, i = %wd\n", n, e, i);
+                acb_printd(roots + i, 20); flint_printf("\n");
+                flint_abort();
+            }
+        }
+
+        /* distinct roots: |z_i - z_j| = 2 |z_i| sin(pi k/n) > |z_i| / n */
+        for (i = 0; i < n; i++)
+        {
+            for (j = i + 1; j < n; j++)
+            {
+                acb_get_mag(tol, roots + i);
+                mag_div_ui(tol, tol, n);
+                acb_sub(w, roots + i, roots + j, 64);
+                acb_get_mag_lower(err, w);
+
+                if (mag_cmp(err, tol) < 0)
+                {
+                    flint_printf("FAIL (distinct)\n");
+                    flint_printf("n = %wd, e = %wd, i = %wd, j = %wd\n", n, e, i, j);
+                    flint_abort();
+                }
+            }
+        }
+
+        _acb_vec_clear(roots, n);
+        fmpz_poly_clear(f);
+        acb_clear(w);
+        mag_clear(err);
+        mag_clear(tol);
+    }
+
+    /* (x^m - 2^m)(x^m - 1) with degree above 2048: after scaling, half
+       of the roots lie on a circle of radius sqrt(2), where f itself
+       overflows in double precision */
+    for (iter = 0; iter < 1 * arb_test_multiplier(); iter++)
+    {
+        fmpz_poly_t f, g;
+        acb_ptr roots;
+        acb_t w;
+        mag_t err, err2, tol;
+        slong i, m, n;
+        int result;
+
+        m = 1025 + n_randint(state, 500);
+        n = 2 * m;
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        acb_init(w);
+        mag_init(err);
+        mag_init(err2);
+        mag_init(tol);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        fmpz_poly_set_coeff_si(f, 0, -1);
+        fmpz_poly_set_coeff_ui(f, m, 1);
+        fmpz_poly_set(g, f);
+        fmpz_mul_2exp(g->coeffs, g->coeffs, m);
+        fmpz_poly_mul(f, f, g);
+
+        roots = _acb_vec_init(n);
+
+        result = arb_fmpz_poly_complex_roots_double(roots, f, 0);
+
+        if (result != 1)
+        {
+            flint_printf("FAIL (result, large degree)\n");
+            flint_printf("m = %wd, result = %d\n", m, result);
+            flint_abort();
+        }
+
+        /* z^m = 1 or (z/2)^m = 1 */
+        mag_set_d(tol, 1e-8);
+        for (i = 0; i < n; i++)
+        {
+            acb_pow_ui(w, roots + i, m, 64);
+            acb_sub_ui(w, w, 1, 64);
+            acb_get_mag(err, w);
+
+            acb_mul_2exp_si(w, roots + i, -1);
+            acb_pow_ui(w, w, m, 64);
+            acb_sub_ui(w, w, 1, 64);
+            acb_get_mag(err2, w);
+
+            if (mag_cmp(err, tol) > 0 && mag_cmp(err2, tol) > 0)
+            {
+                flint_printf("FAIL (accuracy, large degree)\n");
+                flint_printf("m = %wd, i = %wd\n", m, i);
+                acb_printd(roots + i, 20); flint_printf("\n");
+                flint_abort();
+            }
+        }
+
+        _acb_vec_clear(roots, n);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        acb_clear(w);
+        mag_clear(err);
+        mag_clear(err2);
+        mag_clear(tol);
+    }
+
+    /* random polynomials: the result must not depend on the threads */
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        fmpz_poly_t f;
+        acb_ptr r1, r2;
+        slong i, n;
+        int res1, res2;
+
+        n = 2 + n_randint(state, 120);
+
+        fmpz_poly_init(f);
+
+        do {
+            fmpz_poly_randtest(f, state, n + 1, 1 + n_randint(state, 100));
+        } while (fmpz_poly_degree(f) < 1);
+
+        n = fmpz_poly_degree(f);
+        r1 = _acb_vec_init(n);
+        r2 = _acb_vec_init(n);
+
+        flint_set_num_threads(1);
+        res1 = arb_fmpz_poly_complex_roots_double(r1, f, 0);
+        flint_set_num_threads(2 + n_randint(state, 3));
+        res2 = arb_fmpz_poly_complex_roots_double(r2, f, 0);
+
+        if (res1 != res2)
+        {
+            flint_printf("FAIL (threads, result)\n");
+            fmpz_poly_print(f); flint_printf("\n");
+            flint_abort();
+        }
+
+        if (res1 != -1)
+        {
+            for (i = 0; i < n; i++)
+            {
+                if (!acb_equal(r1 + i, r2 + i))
+                {
+                    flint_printf("FAIL (threads)\n");
+                    fmpz_poly_print(f); flint_printf("\n");
+                    flint_abort();
+                }
+            }
+        }
+
+        _acb_vec_clear(r1, n);
+        _acb_vec_clear(r2, n);
+        fmpz_poly_clear(f);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -156,6 +156,9 @@ int arb_fpwrap_cdouble_polygamma(complex_double * res, complex_double s, complex
 int arb_fpwrap_double_polylog(double * res, double s, double z, int flags);
 int arb_fpwrap_cdouble_polylog(complex_double * res, complex_double s, complex_double z, int flags);
 
+int arb_fpwrap_double_dilog(double * res, double x, int flags);
+int arb_fpwrap_cdouble_dilog(complex_double * res, complex_double x, int flags);
+
 int arb_fpwrap_double_lerch_phi(double * res, double z, double s, double a, int flags);
 int arb_fpwrap_cdouble_lerch_phi(complex_double * res, complex_double z, complex_double s, complex_double a, int flags);
 
@@ -328,6 +331,302 @@ int arb_fpwrap_cdouble_modular_j(complex_double * res, complex_double tau, int f
 int arb_fpwrap_cdouble_modular_lambda(complex_double * res, complex_double tau, int flags);
 int arb_fpwrap_cdouble_modular_delta(complex_double * res, complex_double tau, int flags);
 
+/* Vector versions */
+
+int arb_fpwrap_double_exp_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_exp_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_expm1_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_expm1_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_log_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_log_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_log1p_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_log1p_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_pow_vec(double * res, const double * x, const double * y, slong len, int flags);
+int arb_fpwrap_cdouble_pow_vec(complex_double * res, const complex_double * x, const complex_double * y, slong len, int flags);
+
+int arb_fpwrap_double_sqrt_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_sqrt_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_rsqrt_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_rsqrt_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_cbrt_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_cbrt_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_sin_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_sin_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_cos_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_cos_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_tan_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_tan_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_cot_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_cot_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_sec_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_sec_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_csc_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_csc_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_sinc_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_sinc_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_sin_pi_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_sin_pi_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_cos_pi_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_cos_pi_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_tan_pi_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_tan_pi_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_cot_pi_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_cot_pi_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_sinc_pi_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_sinc_pi_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_asin_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_asin_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_acos_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_acos_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_atan_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_atan_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_atan2_vec(double * res, const double * x1, const double * x2, slong len, int flags);
+
+int arb_fpwrap_double_asinh_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_asinh_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_acosh_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_acosh_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_atanh_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_atanh_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_rising_vec(double * res, const double * x, const double * n, slong len, int flags);
+int arb_fpwrap_cdouble_rising_vec(complex_double * res, const complex_double * x, const complex_double * n, slong len, int flags);
+
+int arb_fpwrap_double_gamma_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_gamma_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_rgamma_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_rgamma_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_lgamma_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_lgamma_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_digamma_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_digamma_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_zeta_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_zeta_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_hurwitz_zeta_vec(double * res, const double * s, const double * z, slong len, int flags);
+int arb_fpwrap_cdouble_hurwitz_zeta_vec(complex_double * res, const complex_double * s, const complex_double * z, slong len, int flags);
+
+int arb_fpwrap_double_barnes_g_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_barnes_g_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_log_barnes_g_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_log_barnes_g_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_polygamma_vec(double * res, const double * s, const double * z, slong len, int flags);
+int arb_fpwrap_cdouble_polygamma_vec(complex_double * res, const complex_double * s, const complex_double * z, slong len, int flags);
+
+int arb_fpwrap_double_polylog_vec(double * res, const double * s, const double * z, slong len, int flags);
+int arb_fpwrap_cdouble_polylog_vec(complex_double * res, const complex_double * s, const complex_double * z, slong len, int flags);
+
+int arb_fpwrap_double_dilog_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_dilog_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_lerch_phi_vec(double * res, const double * z, const double * s, const double * a, slong len, int flags);
+int arb_fpwrap_cdouble_lerch_phi_vec(complex_double * res, const complex_double * z, const complex_double * s, const complex_double * a, slong len, int flags);
+
+int arb_fpwrap_cdouble_dirichlet_eta_vec(complex_double * res, const complex_double * s, slong len, int flags);
+int arb_fpwrap_cdouble_riemann_xi_vec(complex_double * res, const complex_double * s, slong len, int flags);
+int arb_fpwrap_cdouble_hardy_theta_vec(complex_double * res, const complex_double * z, slong len, int flags);
+int arb_fpwrap_cdouble_hardy_z_vec(complex_double * res, const complex_double * z, slong len, int flags);
+
+int arb_fpwrap_double_erf_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_erf_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_erfc_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_erfc_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_erfi_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_erfi_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_erfinv_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_double_erfcinv_vec(double * res, const double * x, slong len, int flags);
+
+int arb_fpwrap_double_fresnel_s_vec(double * res, const double * x, int normalized, slong len, int flags);
+int arb_fpwrap_cdouble_fresnel_s_vec(complex_double * res, const complex_double * x, int normalized, slong len, int flags);
+
+int arb_fpwrap_double_fresnel_c_vec(double * res, const double * x, int normalized, slong len, int flags);
+int arb_fpwrap_cdouble_fresnel_c_vec(complex_double * res, const complex_double * x, int normalized, slong len, int flags);
+
+int arb_fpwrap_double_gamma_upper_vec(double * res, const double * s, const double * z, int regularized, slong len, int flags);
+int arb_fpwrap_cdouble_gamma_upper_vec(complex_double * res, const complex_double * s, const complex_double * z, int regularized, slong len, int flags);
+
+int arb_fpwrap_double_gamma_lower_vec(double * res, const double * s, const double * z, int regularized, slong len, int flags);
+int arb_fpwrap_cdouble_gamma_lower_vec(complex_double * res, const complex_double * s, const complex_double * z, int regularized, slong len, int flags);
+
+int arb_fpwrap_double_beta_lower_vec(double * res, const double * a, const double * b, const double * z, int regularized, slong len, int flags);
+int arb_fpwrap_cdouble_beta_lower_vec(complex_double * res, const complex_double * a, const complex_double * b, const complex_double * z, int regularized, slong len, int flags);
+
+int arb_fpwrap_double_exp_integral_e_vec(double * res, const double * s, const double * z, slong len, int flags);
+int arb_fpwrap_cdouble_exp_integral_e_vec(complex_double * res, const complex_double * s, const complex_double * z, slong len, int flags);
+
+int arb_fpwrap_double_exp_integral_ei_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_exp_integral_ei_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_sin_integral_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_sin_integral_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_cos_integral_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_cos_integral_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_sinh_integral_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_sinh_integral_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_cosh_integral_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_cosh_integral_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_log_integral_vec(double * res, const double * x, int offset, slong len, int flags);
+int arb_fpwrap_cdouble_log_integral_vec(complex_double * res, const complex_double * x, int offset, slong len, int flags);
+
+int arb_fpwrap_double_bessel_j_vec(double * res, const double * nu, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_bessel_j_vec(complex_double * res, const complex_double * nu, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_bessel_y_vec(double * res, const double * nu, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_bessel_y_vec(complex_double * res, const complex_double * nu, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_bessel_i_vec(double * res, const double * nu, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_bessel_i_vec(complex_double * res, const complex_double * nu, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_bessel_k_vec(double * res, const double * nu, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_bessel_k_vec(complex_double * res, const complex_double * nu, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_bessel_k_scaled_vec(double * res, const double * nu, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_bessel_k_scaled_vec(complex_double * res, const complex_double * nu, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_airy_ai_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_airy_ai_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_airy_ai_prime_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_airy_ai_prime_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_airy_bi_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_airy_bi_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_airy_bi_prime_vec(double * res, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_airy_bi_prime_vec(complex_double * res, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_coulomb_f_vec(double * res, const double * l, const double * eta, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_coulomb_f_vec(complex_double * res, const complex_double * l, const complex_double * eta, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_coulomb_g_vec(double * res, const double * l, const double * eta, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_coulomb_g_vec(complex_double * res, const complex_double * l, const complex_double * eta, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_cdouble_coulomb_hpos_vec(complex_double * res, const complex_double * l, const complex_double * eta, const complex_double * x, slong len, int flags);
+int arb_fpwrap_cdouble_coulomb_hneg_vec(complex_double * res, const complex_double * l, const complex_double * eta, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_chebyshev_t_vec(double * res, const double * n, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_chebyshev_t_vec(complex_double * res, const complex_double * n, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_chebyshev_u_vec(double * res, const double * n, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_chebyshev_u_vec(complex_double * res, const complex_double * n, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_jacobi_p_vec(double * res, const double * n, const double * a, const double * b, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_jacobi_p_vec(complex_double * res, const complex_double * n, const complex_double * a, const complex_double * b, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_gegenbauer_c_vec(double * res, const double * n, const double * m, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_gegenbauer_c_vec(complex_double * res, const complex_double * n, const complex_double * m, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_laguerre_l_vec(double * res, const double * n, const double * m, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_laguerre_l_vec(complex_double * res, const complex_double * n, const complex_double * m, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_hermite_h_vec(double * res, const double * n, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_hermite_h_vec(complex_double * res, const complex_double * n, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_legendre_p_vec(double * res, const double * n, const double * m, const double * x, int type, slong len, int flags);
+int arb_fpwrap_cdouble_legendre_p_vec(complex_double * res, const complex_double * n, const complex_double * m, const complex_double * x, int type, slong len, int flags);
+
+int arb_fpwrap_double_legendre_q_vec(double * res, const double * n, const double * m, const double * x, int type, slong len, int flags);
+int arb_fpwrap_cdouble_legendre_q_vec(complex_double * res, const complex_double * n, const complex_double * m, const complex_double * x, int type, slong len, int flags);
+
+int arb_fpwrap_double_hypgeom_0f1_vec(double * res, const double * a, const double * x, int regularized, slong len, int flags);
+int arb_fpwrap_cdouble_hypgeom_0f1_vec(complex_double * res, const complex_double * a, const complex_double * x, int regularized, slong len, int flags);
+
+int arb_fpwrap_double_hypgeom_1f1_vec(double * res, const double * a, const double * b, const double * x, int regularized, slong len, int flags);
+int arb_fpwrap_cdouble_hypgeom_1f1_vec(complex_double * res, const complex_double * a, const complex_double * b, const complex_double * x, int regularized, slong len, int flags);
+
+int arb_fpwrap_double_hypgeom_u_vec(double * res, const double * a, const double * b, const double * x, slong len, int flags);
+int arb_fpwrap_cdouble_hypgeom_u_vec(complex_double * res, const complex_double * a, const complex_double * b, const complex_double * x, slong len, int flags);
+
+int arb_fpwrap_double_hypgeom_2f1_vec(double * res, const double * a, const double * b, const double * c, const double * x, int regularized, slong len, int flags);
+int arb_fpwrap_cdouble_hypgeom_2f1_vec(complex_double * res, const complex_double * a, const complex_double * b, const complex_double * c, const complex_double * x, int regularized, slong len, int flags);
+
+int arb_fpwrap_double_agm_vec(double * res, const double * x, const double * y, slong len, int flags);
+int arb_fpwrap_cdouble_agm_vec(complex_double * res, const complex_double * x, const complex_double * y, slong len, int flags);
+
+int arb_fpwrap_cdouble_elliptic_k_vec(complex_double * res, const complex_double * m, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_e_vec(complex_double * res, const complex_double * m, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_pi_vec(complex_double * res, const complex_double * n, const complex_double * m, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_f_vec(complex_double * res, const complex_double * phi, const complex_double * m, int pi, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_e_inc_vec(complex_double * res, const complex_double * phi, const complex_double * m, int pi, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_pi_inc_vec(complex_double * res, const complex_double * n, const complex_double * phi, const complex_double * m, int pi, slong len, int flags);
+
+int arb_fpwrap_cdouble_elliptic_rf_vec(complex_double * res, const complex_double * x, const complex_double * y, const complex_double * z, int option, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_rg_vec(complex_double * res, const complex_double * x, const complex_double * y, const complex_double * z, int option, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_rj_vec(complex_double * res, const complex_double * x, const complex_double * y, const complex_double * z, const complex_double * w, int option, slong len, int flags);
+
+int arb_fpwrap_cdouble_elliptic_p_vec(complex_double * res, const complex_double * z, const complex_double * tau, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_p_prime_vec(complex_double * res, const complex_double * z, const complex_double * tau, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_inv_p_vec(complex_double * res, const complex_double * z, const complex_double * tau, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_zeta_vec(complex_double * res, const complex_double * z, const complex_double * tau, slong len, int flags);
+int arb_fpwrap_cdouble_elliptic_sigma_vec(complex_double * res, const complex_double * z, const complex_double * tau, slong len, int flags);
+
+int arb_fpwrap_cdouble_jacobi_theta_1_vec(complex_double * res, const complex_double * z, const complex_double * tau, slong len, int flags);
+int arb_fpwrap_cdouble_jacobi_theta_2_vec(complex_double * res, const complex_double * z, const complex_double * tau, slong len, int flags);
+int arb_fpwrap_cdouble_jacobi_theta_3_vec(complex_double * res, const complex_double * z, const complex_double * tau, slong len, int flags);
+int arb_fpwrap_cdouble_jacobi_theta_4_vec(complex_double * res, const complex_double * z, const complex_double * tau, slong len, int flags);
+
+int arb_fpwrap_cdouble_dedekind_eta_vec(complex_double * res, const complex_double * tau, slong len, int flags);
+int arb_fpwrap_cdouble_modular_j_vec(complex_double * res, const complex_double * tau, slong len, int flags);
+int arb_fpwrap_cdouble_modular_lambda_vec(complex_double * res, const complex_double * tau, slong len, int flags);
+int arb_fpwrap_cdouble_modular_delta_vec(complex_double * res, const complex_double * tau, slong len, int flags);
+
+int arb_fpwrap_double_lambertw_vec(double * res, const double * x, slong branch, slong len, int flags);
+int arb_fpwrap_cdouble_lambertw_vec(complex_double * res, const complex_double * x, slong branch, slong len, int flags);
+
+/* The zero and root functions take a starting index rather than an
+   input array: entry i of the output is the zero with index n + i
+   (the Legendre root with index k + i). */
+
+int arb_fpwrap_cdouble_zeta_zero_vec(complex_double * res, ulong n, slong len, int flags);
+
+int arb_fpwrap_double_airy_ai_zero_vec(double * res, ulong n, slong len, int flags);
+int arb_fpwrap_double_airy_ai_prime_zero_vec(double * res, ulong n, slong len, int flags);
+int arb_fpwrap_double_airy_bi_zero_vec(double * res, ulong n, slong len, int flags);
+int arb_fpwrap_double_airy_bi_prime_zero_vec(double * res, ulong n, slong len, int flags);
+
+int arb_fpwrap_double_legendre_root_vec(double * res1, double * res2, ulong n, ulong k, slong len, int flags);
+int arb_fpwrap_cdouble_spherical_y_vec(complex_double * res, slong n, slong m, const complex_double * x1, const complex_double * x2, slong len, int flags);
+
+int arb_fpwrap_double_hypgeom_pfq_vec(double * res, const double * a, slong p, const double * b, slong q, const double * z, int regularized, slong len, int flags);
+int arb_fpwrap_cdouble_hypgeom_pfq_vec(complex_double * res, const complex_double * a, slong p, const complex_double * b, slong q, const complex_double * z, int regularized, slong len, int flags);
+
 #ifdef __cplusplus
 }
 #endif
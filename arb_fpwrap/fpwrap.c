@@ -10,6 +10,8 @@
 */
 
 #include <math.h>
+#include <float.h>
+#include <limits.h>
 
 #include "arb.h"
 #include "acb.h"
@@ -164,6 +166,332 @@ double_wp_max(int flags)
 }
 
 
+/* Fast path for elementary functions using double-double arithmetic.
+
+The kernels below compute an unevaluated sum hi + lo approximating f(x).
+We derive an a priori bound for the relative error from the operation
+counts, with u = 2^-53 and only first-order terms in u^2 (the neglected
+terms are O(u^3) per operation).
+
+Per-operation bounds. dd_mul is DWTimesDW1 and dd_div_d is DWDivFP1 of
+Joldes, Muller and Popescu, "Tight and rigorous error bounds for basic
+building blocks of double-word arithmetic" (ACM TOMS, 2017), with
+relative errors at most 7u^2 and 3.5u^2. For dd_add (the "sloppy"
+addition), the two roundings of the low parts give the absolute error
+u^2 (2 (|a| + |b|) + |a + b|). In dd_div, q = a.hi / b.hi has relative
+error 3u, so the remainder a - qb is at most 3u|a|; the product (7u^2)
+and the subtraction (4u^2 |a|) together with the final division of the
+remainder (3u * 3u) give the relative error 20u^2.
+
+exp. Here k LN2_1 and k LN2_2 are exact, and the remaining roundings
+in r = x - k log(2) give an absolute error of 1.1u^2. In each Horner
+step, y = t r / j has |y| <= 0.5 and relative error 10.5u^2. Adding 1
+costs 4.5u^2, and the earlier errors are damped by |r| / j <= 0.35. So
+the polynomial has absolute error 15u^2. The error in r adds 1.6u^2,
+and the truncation (|r|^23 / 23!) adds 0.1u^2. Relative to exp(r) >= 0.7,
+this gives 24u^2. Scaling by 2^k is exact, except that the low part may
+become subnormal, which adds at most 2^-1075 / 2^-982 = 2^-93.
+
+log. We have s <= 0.172, with error 20u^2 in s and 47u^2 in s^2. Each
+Horner step adds 8.2u^2 to t in [1, 1.011] (product 1.6u^2, reciprocal
+3.5u^2, same-sign addition 3.1u^2), plus 0.03 times the earlier error,
+so t has error 8.5u^2. The truncation error is 0.6u^2. So log(m) = 2ts
+has error 36.1u^2. For e = 0 the final addition is exact. Otherwise
+|e log(2)| >= 2 |log(m)|, so that the errors of e log(2) (3u^2) and of
+the final addition (7u^2), relative to the result, are at most 6u^2 and
+7u^2, which gives 50u^2.
+
+Thus both kernels are accurate to 2^-92, and DD_ERROR_BOUND = 2^-80
+leaves a margin of 2^12 for the neglected higher-order terms. Given this
+bound, the result is accurate to 53 bits. It is correctly rounded when
+both endpoints of the error interval round to the same double.
+
+Double-double arithmetic requires that every operation is rounded
+to double precision in round-to-nearest mode; we check this at
+compile time (x87 extended precision excluded) and at runtime,
+and otherwise let the caller fall back to ball arithmetic.
+*/
+
+#if defined(FLT_EVAL_METHOD)
+#define FPWRAP_EVAL_METHOD FLT_EVAL_METHOD
+#elif defined(__FLT_EVAL_METHOD__)
+#define FPWRAP_EVAL_METHOD __FLT_EVAL_METHOD__
+#else
+#define FPWRAP_EVAL_METHOD -1
+#endif
+
+#if (FPWRAP_EVAL_METHOD >= 0) && (FPWRAP_EVAL_METHOD != 2)
+#define FPWRAP_HAVE_FAST 1
+#else
+#define FPWRAP_HAVE_FAST 0
+#endif
+
+#if FPWRAP_HAVE_FAST
+
+/* The error-free transformations must not be fused into FMA
+   instructions by the compiler. */
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+#define DD_ERROR_BOUND 8.2718061255302767488e-25   /* 2^-80 */
+#define DD_SPLITTER 134217729.0                     /* 2^27 + 1 */
+#define DD_INV_LN2 1.4426950408889634074
+#define DD_SQRT_HALF 0.70710678118654752440
+
+/* log(2) = LN2_1 + LN2_2 + LN2_3 where LN2_1 has 42 significant bits
+   so that k * LN2_1 is exact for |k| < 2048 */
+#define DD_LN2_1 0.69314718055989033019
+#define DD_LN2_2 5.4979230187083711552e-14
+#define DD_LN2_3 1.9470450923807499075e-31
+
+#define DD_EXP_TERMS 22
+#define DD_LOG_TERMS 19
+
+typedef struct
+{
+    double hi;
+    double lo;
+}
+dd_t;
+
+static __inline__ dd_t
+dd_fast_two_sum(double a, double b)
+{
+    dd_t res;
+    res.hi = a + b;
+    res.lo = b - (res.hi - a);
+    return res;
+}
+
+static __inline__ dd_t
+dd_two_sum(double a, double b)
+{
+    dd_t res;
+    double bb;
+    res.hi = a + b;
+    bb = res.hi - a;
+    res.lo = (a - (res.hi - bb)) + (b - bb);
+    return res;
+}
+
+static __inline__ dd_t
+dd_two_prod(double a, double b)
+{
+    dd_t res;
+    double c, ah, al, bh, bl;
+
+    c = DD_SPLITTER * a;
+    ah = c - (c - a);
+    al = a - ah;
+    c = DD_SPLITTER * b;
+    bh = c - (c - b);
+    bl = b - bh;
+
+    res.hi = a * b;
+    res.lo = ((ah * bh - res.hi) + ah * bl + al * bh) + al * bl;
+    return res;
+}
+
+static __inline__ dd_t
+dd_add(dd_t a, dd_t b)
+{
+    dd_t s;
+    s = dd_two_sum(a.hi, b.hi);
+    return dd_fast_two_sum(s.hi, s.lo + (a.lo + b.lo));
+}
+
+static __inline__ dd_t
+dd_mul(dd_t a, dd_t b)
+{
+    dd_t p;
+    p = dd_two_prod(a.hi, b.hi);
+    return dd_fast_two_sum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+}
+
+static __inline__ dd_t
+dd_div_d(dd_t a, double b)
+{
+    dd_t p;
+    double q, s;
+
+    q = a.hi / b;
+    p = dd_two_prod(q, b);
+    s = ((a.hi - p.hi) - p.lo) + a.lo;
+    return dd_fast_two_sum(q, s / b);
+}
+
+static __inline__ dd_t
+dd_div(dd_t a, dd_t b)
+{
+    dd_t p, r;
+    double q;
+
+    q = a.hi / b.hi;
+    r.hi = q;
+    r.lo = 0.0;
+    p = dd_mul(r, b);
+    p.hi = -p.hi;
+    p.lo = -p.lo;
+    r = dd_add(a, p);
+    return dd_fast_two_sum(q, r.hi / b.hi);
+}
+
+static __inline__ dd_t
+dd_set_d(double x)
+{
+    dd_t res;
+    res.hi = x;
+    res.lo = 0.0;
+    return res;
+}
+
+/* Detects a non-default rounding mode. */
+static int
+dd_round_nearest(void)
+{
+    volatile double one = 1.0, tiny = 1e-18;
+    return (one + tiny == one) && (one - tiny == one);
+}
+
+static int
+dd_round_checked(double * res, dd_t y, int flags)
+{
+    double e, a, b;
+
+    if (flags & FPWRAP_CORRECT_ROUNDING)
+    {
+        e = 2.0 * DD_ERROR_BOUND * fabs(y.hi);
+        a = y.hi + (y.lo - e);
+        b = y.hi + (y.lo + e);
+
+        if (a != b)
+            return 0;
+
+        *res = a;
+    }
+    else
+    {
+        *res = y.hi + y.lo;
+    }
+
+    return 1;
+}
+
+/* exp(x) = 2^k exp(r), r = x - k log(2), |r| <= log(2)/2 + eps.
+   We exclude input where the output or the low part of the output
+   would be subnormal or overflow. */
+static int
+_arb_fpwrap_double_exp_fast(double * res, double x, int flags)
+{
+    dd_t r, t, p;
+    double k;
+    slong j;
+
+    if (!(x >= -680.0 && x <= 700.0) || !dd_round_nearest())
+        return 0;
+
+    k = floor(x * DD_INV_LN2 + 0.5);
+
+    r = dd_two_sum(x, -k * DD_LN2_1);
+    p = dd_two_prod(k, DD_LN2_2);
+    p.hi = -p.hi;
+    p.lo = -p.lo - k * DD_LN2_3;
+    r = dd_add(r, p);
+
+    /* Horner scheme for 1 + r (1 + r/2 (1 + r/3 (...))) */
+    t = dd_set_d(1.0);
+    for (j = DD_EXP_TERMS; j >= 1; j--)
+    {
+        t = dd_mul(t, r);
+        t = dd_div_d(t, j);
+        t = dd_add(t, dd_set_d(1.0));
+    }
+
+    t.hi = ldexp(t.hi, (int) k);
+    t.lo = ldexp(t.lo, (int) k);
+
+    return dd_round_checked(res, t, flags);
+}
+
+/* log(x) = e log(2) + log(m) with sqrt(1/2) <= m < sqrt(2), and
+   log(m) = 2 atanh(s), s = (m-1)/(m+1), |s| <= 0.172. */
+static int
+_arb_fpwrap_double_log_fast(double * res, double x, int flags)
+{
+    dd_t s, s2, t, p;
+    double m;
+    int e;
+    slong j;
+
+    if (!(x > 0.0 && x <= DBL_MAX) || !dd_round_nearest())
+        return 0;
+
+    m = frexp(x, &e);
+
+    if (m < DD_SQRT_HALF)
+    {
+        m *= 2.0;
+        e -= 1;
+    }
+
+    /* m - 1 is exact */
+    s = dd_div(dd_set_d(m - 1.0), dd_two_sum(m, 1.0));
+    s2 = dd_mul(s, s);
+
+    t = dd_div_d(dd_set_d(1.0), 2 * DD_LOG_TERMS + 1);
+    for (j = DD_LOG_TERMS - 1; j >= 0; j--)
+    {
+        t = dd_mul(t, s2);
+        t = dd_add(t, dd_div_d(dd_set_d(1.0), 2 * j + 1));
+    }
+
+    t = dd_mul(t, s);
+    t.hi *= 2.0;
+    t.lo *= 2.0;
+
+    p = dd_two_prod(e, DD_LN2_2);
+    p.lo += e * DD_LN2_3;
+    p = dd_add(dd_set_d(e * DD_LN2_1), p);
+    t = dd_add(p, t);
+
+    return dd_round_checked(res, t, flags);
+}
+
+/* The square root is correctly rounded in IEEE 754 arithmetic. */
+static int
+_arb_fpwrap_double_sqrt_fast(double * res, double x, int flags)
+{
+#if defined(__STDC_IEC_559__)
+    if (x >= 0.0 && x <= DBL_MAX && dd_round_nearest())
+    {
+        *res = sqrt(x);
+        return 1;
+    }
+#endif
+
+    return 0;
+}
+
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT DEFAULT
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#else
+
+static int _arb_fpwrap_double_exp_fast(double * res, double x, int flags) { return 0; }
+static int _arb_fpwrap_double_log_fast(double * res, double x, int flags) { return 0; }
+static int _arb_fpwrap_double_sqrt_fast(double * res, double x, int flags) { return 0; }
+
+#endif
+
+typedef int (*double_fast_func_1)(double *, double, int);
+
 typedef void (*arb_func_1)(arb_t, const arb_t, slong prec);
 typedef void (*arb_func_2)(arb_t, const arb_t, const arb_t, slong prec);
 typedef void (*arb_func_3)(arb_t, const arb_t, const arb_t, const arb_t, slong prec);
@@ -761,109 +1089,581 @@ int arb_fpwrap_cdouble_4_int(complex_double * res, acb_func_4_int func, complex_
     return status;
 }
 
+/* Vector versions. The whole batch is evaluated at one working precision
+   at a time using a single set of scratch variables; only the elements
+   that fail the accuracy check are kept in the pending list and retried
+   at the next precision. */
+
+typedef union
+{
+    arb_func_1 f1;
+    arb_func_2 f2;
+    arb_func_3 f3;
+    arb_func_4 f4;
+    arb_func_1_int f1_int;
+    arb_func_2_int f2_int;
+    arb_func_3_int f3_int;
+    arb_func_4_int f4_int;
+}
+arb_func_any;
+
+typedef union
+{
+    acb_func_1 f1;
+    acb_func_2 f2;
+    acb_func_3 f3;
+    acb_func_4 f4;
+    acb_func_1_int f1_int;
+    acb_func_2_int f2_int;
+    acb_func_3_int f3_int;
+    acb_func_4_int f4_int;
+}
+acb_func_any;
+
+static void
+_arb_func_any_call(arb_t res, arb_func_any func, int nargs, int use_int, arb_srcptr x, int intx, slong prec)
+{
+    if (use_int)
+    {
+        switch (nargs)
+        {
+            case 1: func.f1_int(res, x, intx, prec); break;
+            case 2: func.f2_int(res, x, x + 1, intx, prec); break;
+            case 3: func.f3_int(res, x, x + 1, x + 2, intx, prec); break;
+            default: func.f4_int(res, x, x + 1, x + 2, x + 3, intx, prec);
+        }
+    }
+    else
+    {
+        switch (nargs)
+        {
+            case 1: func.f1(res, x, prec); break;
+            case 2: func.f2(res, x, x + 1, prec); break;
+            case 3: func.f3(res, x, x + 1, x + 2, prec); break;
+            default: func.f4(res, x, x + 1, x + 2, x + 3, prec);
+        }
+    }
+}
+
+static void
+_acb_func_any_call(acb_t res, acb_func_any func, int nargs, int use_int, acb_srcptr x, int intx, slong prec)
+{
+    if (use_int)
+    {
+        switch (nargs)
+        {
+            case 1: func.f1_int(res, x, intx, prec); break;
+            case 2: func.f2_int(res, x, x + 1, intx, prec); break;
+            case 3: func.f3_int(res, x, x + 1, x + 2, intx, prec); break;
+            default: func.f4_int(res, x, x + 1, x + 2, x + 3, intx, prec);
+        }
+    }
+    else
+    {
+        switch (nargs)
+        {
+            case 1: func.f1(res, x, prec); break;
+            case 2: func.f2(res, x, x + 1, prec); break;
+            case 3: func.f3(res, x, x + 1, x + 2, prec); break;
+            default: func.f4(res, x, x + 1, x + 2, x + 3, prec);
+        }
+    }
+}
+
+static int
+_arb_fpwrap_double_vec(double * res, arb_func_any func, double_fast_func_1 fast, int nargs, int use_int,
+    const double * const * x, int intx, slong n, int flags)
+{
+    arb_t arb_res;
+    arb_ptr arb_x;
+    slong * pending;
+    slong i, j, k, num_pending, num_left, wp, wp_max;
+    int status, finite;
+
+    if (n <= 0)
+        return FPWRAP_SUCCESS;
+
+    arb_init(arb_res);
+    arb_x = _arb_vec_init(nargs);
+    pending = flint_malloc(sizeof(slong) * n);
+
+    status = FPWRAP_SUCCESS;
+    wp_max = double_wp_max(flags);
+    num_pending = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        finite = 1;
+        for (k = 0; k < nargs; k++)
+        {
+            arb_set_d(arb_x + k, x[k][i]);
+            finite = finite && arb_is_finite(arb_x + k);
+        }
+
+        if (!finite)
+        {
+            res[i] = D_NAN;
+            status = FPWRAP_UNABLE;
+        }
+        else if (fast == NULL || !fast(res + i, x[0][i], flags))
+        {
+            pending[num_pending++] = i;
+        }
+    }
+
+    for (wp = WP_INITIAL; num_pending != 0; wp *= 2)
+    {
+        num_left = 0;
+
+        for (j = 0; j < num_pending; j++)
+        {
+            i = pending[j];
+
+            for (k = 0; k < nargs; k++)
+                arb_set_d(arb_x + k, x[k][i]);
+
+            _arb_func_any_call(arb_res, func, nargs, use_int, arb_x, intx, wp);
+
+            if (arb_accurate_enough_d(arb_res, flags))
+            {
+                res[i] = arf_get_d(arb_midref(arb_res), ARF_RND_NEAR);
+            }
+            else if (wp >= wp_max)
+            {
+                res[i] = D_NAN;
+                status = FPWRAP_UNABLE;
+            }
+            else
+            {
+                pending[num_left++] = i;
+            }
+        }
+
+        num_pending = num_left;
+    }
+
+    flint_free(pending);
+    _arb_vec_clear(arb_x, nargs);
+    arb_clear(arb_res);
+
+    return status;
+}
+
+static int
+_arb_fpwrap_cdouble_vec(complex_double * res, acb_func_any func, int nargs, int use_int,
+    const complex_double * const * x, int intx, slong n, int flags)
+{
+    acb_t acb_res;
+    acb_ptr acb_x;
+    slong * pending;
+    slong i, j, k, num_pending, num_left, wp, wp_max;
+    int status, finite;
+
+    if (n <= 0)
+        return FPWRAP_SUCCESS;
+
+    acb_init(acb_res);
+    acb_x = _acb_vec_init(nargs);
+    pending = flint_malloc(sizeof(slong) * n);
+
+    status = FPWRAP_SUCCESS;
+    wp_max = double_wp_max(flags);
+    num_pending = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        finite = 1;
+        for (k = 0; k < nargs; k++)
+        {
+            acb_set_d_d(acb_x + k, x[k][i].real, x[k][i].imag);
+            finite = finite && acb_is_finite(acb_x + k);
+        }
+
+        if (finite)
+        {
+            pending[num_pending++] = i;
+        }
+        else
+        {
+            res[i].real = D_NAN;
+            res[i].imag = D_NAN;
+            status = FPWRAP_UNABLE;
+        }
+    }
+
+    for (wp = WP_INITIAL; num_pending != 0; wp *= 2)
+    {
+        num_left = 0;
+
+        for (j = 0; j < num_pending; j++)
+        {
+            i = pending[j];
+
+            for (k = 0; k < nargs; k++)
+                acb_set_d_d(acb_x + k, x[k][i].real, x[k][i].imag);
+
+            _acb_func_any_call(acb_res, func, nargs, use_int, acb_x, intx, wp);
+
+            if (acb_accurate_enough_d(acb_res, flags))
+            {
+                res[i].real = arf_get_d(arb_midref(acb_realref(acb_res)), ARF_RND_NEAR);
+                res[i].imag = arf_get_d(arb_midref(acb_imagref(acb_res)), ARF_RND_NEAR);
+            }
+            else if (wp >= wp_max)
+            {
+                res[i].real = D_NAN;
+                res[i].imag = D_NAN;
+                status = FPWRAP_UNABLE;
+            }
+            else
+            {
+                pending[num_left++] = i;
+            }
+        }
+
+        num_pending = num_left;
+    }
+
+    flint_free(pending);
+    _acb_vec_clear(acb_x, nargs);
+    acb_clear(acb_res);
+
+    return status;
+}
+
+int arb_fpwrap_double_1_vec(double * res, arb_func_1 func, const double * x, slong n, int flags)
+{
+    arb_func_any f;
+    const double * xs[1];
+    f.f1 = func;
+    xs[0] = x;
+    return _arb_fpwrap_double_vec(res, f, NULL, 1, 0, xs, 0, n, flags);
+}
+
+static int
+_arb_fpwrap_double_1_fast_vec(double * res, arb_func_1 func, double_fast_func_1 fast, const double * x, slong n, int flags)
+{
+    arb_func_any f;
+    const double * xs[1];
+    f.f1 = func;
+    xs[0] = x;
+    return _arb_fpwrap_double_vec(res, f, fast, 1, 0, xs, 0, n, flags);
+}
+
+int arb_fpwrap_double_2_vec(double * res, arb_func_2 func, const double * x1, const double * x2, slong n, int flags)
+{
+    arb_func_any f;
+    const double * xs[2];
+    f.f2 = func;
+    xs[0] = x1; xs[1] = x2;
+    return _arb_fpwrap_double_vec(res, f, NULL, 2, 0, xs, 0, n, flags);
+}
+
+int arb_fpwrap_double_3_vec(double * res, arb_func_3 func, const double * x1, const double * x2, const double * x3, slong n, int flags)
+{
+    arb_func_any f;
+    const double * xs[3];
+    f.f3 = func;
+    xs[0] = x1; xs[1] = x2; xs[2] = x3;
+    return _arb_fpwrap_double_vec(res, f, NULL, 3, 0, xs, 0, n, flags);
+}
+
+int arb_fpwrap_double_4_vec(double * res, arb_func_4 func, const double * x1, const double * x2, const double * x3, const double * x4, slong n, int flags)
+{
+    arb_func_any f;
+    const double * xs[4];
+    f.f4 = func;
+    xs[0] = x1; xs[1] = x2; xs[2] = x3; xs[3] = x4;
+    return _arb_fpwrap_double_vec(res, f, NULL, 4, 0, xs, 0, n, flags);
+}
+
+int arb_fpwrap_cdouble_1_vec(complex_double * res, acb_func_1 func, const complex_double * x, slong n, int flags)
+{
+    acb_func_any f;
+    const complex_double * xs[1];
+    f.f1 = func;
+    xs[0] = x;
+    return _arb_fpwrap_cdouble_vec(res, f, 1, 0, xs, 0, n, flags);
+}
+
+int arb_fpwrap_cdouble_2_vec(complex_double * res, acb_func_2 func, const complex_double * x1, const complex_double * x2, slong n, int flags)
+{
+    acb_func_any f;
+    const complex_double * xs[2];
+    f.f2 = func;
+    xs[0] = x1; xs[1] = x2;
+    return _arb_fpwrap_cdouble_vec(res, f, 2, 0, xs, 0, n, flags);
+}
+
+int arb_fpwrap_cdouble_3_vec(complex_double * res, acb_func_3 func, const complex_double * x1, const complex_double * x2, const complex_double * x3, slong n, int flags)
+{
+    acb_func_any f;
+    const complex_double * xs[3];
+    f.f3 = func;
+    xs[0] = x1; xs[1] = x2; xs[2] = x3;
+    return _arb_fpwrap_cdouble_vec(res, f, 3, 0, xs, 0, n, flags);
+}
+
+int arb_fpwrap_cdouble_4_vec(complex_double * res, acb_func_4 func, const complex_double * x1, const complex_double * x2, const complex_double * x3, const complex_double * x4, slong n, int flags)
+{
+    acb_func_any f;
+    const complex_double * xs[4];
+    f.f4 = func;
+    xs[0] = x1; xs[1] = x2; xs[2] = x3; xs[3] = x4;
+    return _arb_fpwrap_cdouble_vec(res, f, 4, 0, xs, 0, n, flags);
+}
+
+int arb_fpwrap_double_1_int_vec(double * res, arb_func_1_int func, const double * x, int intx, slong n, int flags)
+{
+    arb_func_any f;
+    const double * xs[1];
+    f.f1_int = func;
+    xs[0] = x;
+    return _arb_fpwrap_double_vec(res, f, NULL, 1, 1, xs, intx, n, flags);
+}
+
+int arb_fpwrap_double_2_int_vec(double * res, arb_func_2_int func, const double * x1, const double * x2, int intx, slong n, int flags)
+{
+    arb_func_any f;
+    const double * xs[2];
+    f.f2_int = func;
+    xs[0] = x1; xs[1] = x2;
+    return _arb_fpwrap_double_vec(res, f, NULL, 2, 1, xs, intx, n, flags);
+}
+
+int arb_fpwrap_double_3_int_vec(double * res, arb_func_3_int func, const double * x1, const double * x2, const double * x3, int intx, slong n, int flags)
+{
+    arb_func_any f;
+    const double * xs[3];
+    f.f3_int = func;
+    xs[0] = x1; xs[1] = x2; xs[2] = x3;
+    return _arb_fpwrap_double_vec(res, f, NULL, 3, 1, xs, intx, n, flags);
+}
+
+int arb_fpwrap_double_4_int_vec(double * res, arb_func_4_int func, const double * x1, const double * x2, const double * x3, const double * x4, int intx, slong n, int flags)
+{
+    arb_func_any f;
+    const double * xs[4];
+    f.f4_int = func;
+    xs[0] = x1; xs[1] = x2; xs[2] = x3; xs[3] = x4;
+    return _arb_fpwrap_double_vec(res, f, NULL, 4, 1, xs, intx, n, flags);
+}
+
+int arb_fpwrap_cdouble_1_int_vec(complex_double * res, acb_func_1_int func, const complex_double * x, int intx, slong n, int flags)
+{
+    acb_func_any f;
+    const complex_double * xs[1];
+    f.f1_int = func;
+    xs[0] = x;
+    return _arb_fpwrap_cdouble_vec(res, f, 1, 1, xs, intx, n, flags);
+}
+
+int arb_fpwrap_cdouble_2_int_vec(complex_double * res, acb_func_2_int func, const complex_double * x1, const complex_double * x2, int intx, slong n, int flags)
+{
+    acb_func_any f;
+    const complex_double * xs[2];
+    f.f2_int = func;
+    xs[0] = x1; xs[1] = x2;
+    return _arb_fpwrap_cdouble_vec(res, f, 2, 1, xs, intx, n, flags);
+}
+
+int arb_fpwrap_cdouble_3_int_vec(complex_double * res, acb_func_3_int func, const complex_double * x1, const complex_double * x2, const complex_double * x3, int intx, slong n, int flags)
+{
+    acb_func_any f;
+    const complex_double * xs[3];
+    f.f3_int = func;
+    xs[0] = x1; xs[1] = x2; xs[2] = x3;
+    return _arb_fpwrap_cdouble_vec(res, f, 3, 1, xs, intx, n, flags);
+}
+
+int arb_fpwrap_cdouble_4_int_vec(complex_double * res, acb_func_4_int func, const complex_double * x1, const complex_double * x2, const complex_double * x3, const complex_double * x4, int intx, slong n, int flags)
+{
+    acb_func_any f;
+    const complex_double * xs[4];
+    f.f4_int = func;
+    xs[0] = x1; xs[1] = x2; xs[2] = x3; xs[3] = x4;
+    return _arb_fpwrap_cdouble_vec(res, f, 4, 1, xs, intx, n, flags);
+}
+
 #define DEF_DOUBLE_FUN_1(name, arb_fun) \
     int arb_fpwrap_double_ ## name(double * res, double x, int flags) \
     { \
         return arb_fpwrap_double_1(res, arb_fun, x, flags); \
     } \
+    int arb_fpwrap_double_ ## name ## _vec(double * res, const double * x, slong len, int flags) \
+    { \
+        return arb_fpwrap_double_1_vec(res, arb_fun, x, len, flags); \
+    } \
+
+#define DEF_DOUBLE_FUN_1_FAST(name, arb_fun, fast_fun) \
+    int arb_fpwrap_double_ ## name(double * res, double x, int flags) \
+    { \
+        if (fast_fun(res, x, flags)) \
+            return FPWRAP_SUCCESS; \
+        return arb_fpwrap_double_1(res, arb_fun, x, flags); \
+    } \
+    int arb_fpwrap_double_ ## name ## _vec(double * res, const double * x, slong len, int flags) \
+    { \
+        return _arb_fpwrap_double_1_fast_vec(res, arb_fun, fast_fun, x, len, flags); \
+    } \
 
 #define DEF_DOUBLE_FUN_2(name, arb_fun) \
     int arb_fpwrap_double_ ## name(double * res, double x1, double x2, int flags) \
     { \
         return arb_fpwrap_double_2(res, arb_fun, x1, x2, flags); \
     } \
+    int arb_fpwrap_double_ ## name ## _vec(double * res, const double * x1, const double * x2, slong len, int flags) \
+    { \
+        return arb_fpwrap_double_2_vec(res, arb_fun, x1, x2, len, flags); \
+    } \
 
 #define DEF_DOUBLE_FUN_3(name, arb_fun) \
     int arb_fpwrap_double_ ## name(double * res, double x1, double x2, double x3, int flags) \
     { \
         return arb_fpwrap_double_3(res, arb_fun, x1, x2, x3, flags); \
     } \
+    int arb_fpwrap_double_ ## name ## _vec(double * res, const double * x1, const double * x2, const double * x3, slong len, int flags) \
+    { \
+        return arb_fpwrap_double_3_vec(res, arb_fun, x1, x2, x3, len, flags); \
+    } \
 
 #define DEF_DOUBLE_FUN_4(name, arb_fun) \
     int arb_fpwrap_double_ ## name(double * res, double x1, double x2, double x3, double x4, int flags) \
     { \
         return arb_fpwrap_double_4(res, arb_fun, x1, x2, x3, x4, flags); \
     } \
+    int arb_fpwrap_double_ ## name ## _vec(double * res, const double * x1, const double * x2, const double * x3, const double * x4, slong len, int flags) \
+    { \
+        return arb_fpwrap_double_4_vec(res, arb_fun, x1, x2, x3, x4, len, flags); \
+    } \
 
 #define DEF_CDOUBLE_FUN_1(name, acb_fun) \
     int arb_fpwrap_cdouble_ ## name(complex_double * res, complex_double x, int flags) \
     { \
         return arb_fpwrap_cdouble_1(res, acb_fun, x, flags); \
     } \
+    int arb_fpwrap_cdouble_ ## name ## _vec(complex_double * res, const complex_double * x, slong len, int flags) \
+    { \
+        return arb_fpwrap_cdouble_1_vec(res, acb_fun, x, len, flags); \
+    } \
 
 #define DEF_CDOUBLE_FUN_2(name, acb_fun) \
     int arb_fpwrap_cdouble_ ## name(complex_double * res, complex_double x1, complex_double x2, int flags) \
     { \
         return arb_fpwrap_cdouble_2(res, acb_fun, x1, x2, flags); \
     } \
+    int arb_fpwrap_cdouble_ ## name ## _vec(complex_double * res, const complex_double * x1, const complex_double * x2, slong len, int flags) \
+    { \
+        return arb_fpwrap_cdouble_2_vec(res, acb_fun, x1, x2, len, flags); \
+    } \
 
 #define DEF_CDOUBLE_FUN_3(name, acb_fun) \
     int arb_fpwrap_cdouble_ ## name(complex_double * res, complex_double x1, complex_double x2, complex_double x3, int flags) \
     { \
         return arb_fpwrap_cdouble_3(res, acb_fun, x1, x2, x3, flags); \
     } \
+    int arb_fpwrap_cdouble_ ## name ## _vec(complex_double * res, const complex_double * x1, const complex_double * x2, const complex_double * x3, slong len, int flags) \
+    { \
+        return arb_fpwrap_cdouble_3_vec(res, acb_fun, x1, x2, x3, len, flags); \
+    } \
 
 #define DEF_CDOUBLE_FUN_4(name, acb_fun) \
     int arb_fpwrap_cdouble_ ## name(complex_double * res, complex_double x1, complex_double x2, complex_double x3, complex_double x4, int flags) \
     { \
         return arb_fpwrap_cdouble_4(res, acb_fun, x1, x2, x3, x4, flags); \
     } \
+    int arb_fpwrap_cdouble_ ## name ## _vec(complex_double * res, const complex_double * x1, const complex_double * x2, const complex_double * x3, const complex_double * x4, slong len, int flags) \
+    { \
+        return arb_fpwrap_cdouble_4_vec(res, acb_fun, x1, x2, x3, x4, len, flags); \
+    } \
 
 #define DEF_DOUBLE_FUN_1_INT(name, arb_fun) \
     int arb_fpwrap_double_ ## name(double * res, double x, int intx, int flags) \
     { \
         return arb_fpwrap_double_1_int(res, arb_fun, x, intx, flags); \
     } \
+    int arb_fpwrap_double_ ## name ## _vec(double * res, const double * x, int intx, slong len, int flags) \
+    { \
+        return arb_fpwrap_double_1_int_vec(res, arb_fun, x, intx, len, flags); \
+    } \
 
 #define DEF_DOUBLE_FUN_2_INT(name, arb_fun) \
     int arb_fpwrap_double_ ## name(double * res, double x1, double x2, int intx, int flags) \
     { \
         return arb_fpwrap_double_2_int(res, arb_fun, x1, x2, intx, flags); \
     } \
+    int arb_fpwrap_double_ ## name ## _vec(double * res, const double * x1, const double * x2, int intx, slong len, int flags) \
+    { \
+        return arb_fpwrap_double_2_int_vec(res, arb_fun, x1, x2, intx, len, flags); \
+    } \
 
 #define DEF_DOUBLE_FUN_3_INT(name, arb_fun) \
     int arb_fpwrap_double_ ## name(double * res, double x1, double x2, double x3, int intx, int flags) \
     { \
         return arb_fpwrap_double_3_int(res, arb_fun, x1, x2, x3, intx, flags); \
     } \
+    int arb_fpwrap_double_ ## name ## _vec(double * res, const double * x1, const double * x2, const double * x3, int intx, slong len, int flags) \
+    { \
+        return arb_fpwrap_double_3_int_vec(res, arb_fun, x1, x2, x3, intx, len, flags); \
+    } \
 
 #define DEF_DOUBLE_FUN_4_INT(name, arb_fun) \
     int arb_fpwrap_double_ ## name(double * res, double x1, double x2, double x3, double x4, int intx, int flags) \
     { \
         return arb_fpwrap_double_4_int(res, arb_fun, x1, x2, x3, x4, intx, flags); \
     } \
+    int arb_fpwrap_double_ ## name ## _vec(double * res, const double * x1, const double * x2, const double * x3, const double * x4, int intx, slong len, int flags) \
+    { \
+        return arb_fpwrap_double_4_int_vec(res, arb_fun, x1, x2, x3, x4, intx, len, flags); \
+    } \
 
 #define DEF_CDOUBLE_FUN_1_INT(name, acb_fun) \
     int arb_fpwrap_cdouble_ ## name(complex_double * res, complex_double x, int intx, int flags) \
     { \
         return arb_fpwrap_cdouble_1_int(res, acb_fun, x, intx, flags); \
     } \
+    int arb_fpwrap_cdouble_ ## name ## _vec(complex_double * res, const complex_double * x, int intx, slong len, int flags) \
+    { \
+        return arb_fpwrap_cdouble_1_int_vec(res, acb_fun, x, intx, len, flags); \
+    } \
 
 #define DEF_CDOUBLE_FUN_2_INT(name, acb_fun) \
     int arb_fpwrap_cdouble_ ## name(complex_double * res, complex_double x1, complex_double x2, int intx, int flags) \
     { \
         return arb_fpwrap_cdouble_2_int(res, acb_fun, x1, x2, intx, flags); \
     } \
+    int arb_fpwrap_cdouble_ ## name ## _vec(complex_double * res, const complex_double * x1, const complex_double * x2, int intx, slong len, int flags) \
+    { \
+        return arb_fpwrap_cdouble_2_int_vec(res, acb_fun, x1, x2, intx, len, flags); \
+    } \
 
 #define DEF_CDOUBLE_FUN_3_INT(name, acb_fun) \
     int arb_fpwrap_cdouble_ ## name(complex_double * res, complex_double x1, complex_double x2, complex_double x3, int intx, int flags) \
     { \
         return arb_fpwrap_cdouble_3_int(res, acb_fun, x1, x2, x3, intx, flags); \
     } \
+    int arb_fpwrap_cdouble_ ## name ## _vec(complex_double * res, const complex_double * x1, const complex_double * x2, const complex_double * x3, int intx, slong len, int flags) \
+    { \
+        return arb_fpwrap_cdouble_3_int_vec(res, acb_fun, x1, x2, x3, intx, len, flags); \
+    } \
 
 #define DEF_CDOUBLE_FUN_4_INT(name, acb_fun) \
     int arb_fpwrap_cdouble_ ## name(complex_double * res, complex_double x1, complex_double x2, complex_double x3, complex_double x4, int intx, int flags) \
     { \
         return arb_fpwrap_cdouble_4_int(res, acb_fun, x1, x2, x3, x4, intx, flags); \
     } \
+    int arb_fpwrap_cdouble_ ## name ## _vec(complex_double * res, const complex_double * x1, const complex_double * x2, const complex_double * x3, const complex_double * x4, int intx, slong len, int flags) \
+    { \
+        return arb_fpwrap_cdouble_4_int_vec(res, acb_fun, x1, x2, x3, x4, intx, len, flags); \
+    } \
 
-DEF_DOUBLE_FUN_1(exp, arb_exp)
+DEF_DOUBLE_FUN_1_FAST(exp, arb_exp, _arb_fpwrap_double_exp_fast)
 DEF_CDOUBLE_FUN_1(exp, acb_exp)
 
 DEF_DOUBLE_FUN_1(expm1, arb_expm1)
 DEF_CDOUBLE_FUN_1(expm1, acb_expm1)
 
-DEF_DOUBLE_FUN_1(log, arb_log)
+DEF_DOUBLE_FUN_1_FAST(log, arb_log, _arb_fpwrap_double_log_fast)
 DEF_CDOUBLE_FUN_1(log, acb_log)
 
 DEF_DOUBLE_FUN_1(log1p, arb_log1p)
@@ -872,7 +1672,7 @@ DEF_CDOUBLE_FUN_1(log1p, acb_log1p)
 DEF_DOUBLE_FUN_2(pow, arb_pow)
 DEF_CDOUBLE_FUN_2(pow, acb_pow)
 
-DEF_DOUBLE_FUN_1(sqrt, arb_sqrt)
+DEF_DOUBLE_FUN_1_FAST(sqrt, arb_sqrt, _arb_fpwrap_double_sqrt_fast)
 DEF_CDOUBLE_FUN_1(sqrt, acb_sqrt)
 
 DEF_DOUBLE_FUN_1(rsqrt, arb_rsqrt)
@@ -1556,6 +2356,134 @@ int arb_fpwrap_cdouble_lambertw(complex_double * res, complex_double x, slong br
     return status;
 }
 
+/* Vector versions of the functions above that take integer parameters.
+   Lambert W uses the generic vector code; the others call the scalar
+   function for each entry. */
+
+static void
+_arb_lambertw_int(arb_t res, const arb_t x, int branch, slong prec)
+{
+    arb_lambertw(res, x, branch, prec);
+}
+
+static void
+_acb_lambertw_int(acb_t res, const acb_t x, int branch, slong prec)
+{
+    fmpz_t t;
+    fmpz_init(t);
+    fmpz_set_si(t, branch);
+    acb_lambertw(res, x, t, 0, prec);
+    fmpz_clear(t);
+}
+
+int arb_fpwrap_double_lambertw_vec(double * res, const double * x, slong branch, slong len, int flags)
+{
+    slong i;
+
+    if (!(branch == 0 || branch == -1))
+    {
+        for (i = 0; i < len; i++)
+            res[i] = D_NAN;
+        return (len > 0) ? FPWRAP_UNABLE : FPWRAP_SUCCESS;
+    }
+
+    return arb_fpwrap_double_1_int_vec(res, _arb_lambertw_int, x, (branch == -1), len, flags);
+}
+
+int arb_fpwrap_cdouble_lambertw_vec(complex_double * res, const complex_double * x, slong branch, slong len, int flags)
+{
+    slong i;
+    int status;
+
+    if (branch >= INT_MIN && branch <= INT_MAX)
+        return arb_fpwrap_cdouble_1_int_vec(res, _acb_lambertw_int, x, branch, len, flags);
+
+    status = FPWRAP_SUCCESS;
+    for (i = 0; i < len; i++)
+        if (arb_fpwrap_cdouble_lambertw(res + i, x[i], branch, flags) != FPWRAP_SUCCESS)
+            status = FPWRAP_UNABLE;
+
+    return status;
+}
+
+int arb_fpwrap_cdouble_zeta_zero_vec(complex_double * res, ulong n, slong len, int flags)
+{
+    slong i;
+    int status = FPWRAP_SUCCESS;
+
+    for (i = 0; i < len; i++)
+        if (arb_fpwrap_cdouble_zeta_zero(res + i, n + i, flags) != FPWRAP_SUCCESS)
+            status = FPWRAP_UNABLE;
+
+    return status;
+}
+
+int arb_fpwrap_double_legendre_root_vec(double * res1, double * res2, ulong n, ulong k, slong len, int flags)
+{
+    slong i;
+    int status = FPWRAP_SUCCESS;
+
+    for (i = 0; i < len; i++)
+        if (arb_fpwrap_double_legendre_root(res1 + i, res2 + i, n, k + i, flags) != FPWRAP_SUCCESS)
+            status = FPWRAP_UNABLE;
+
+    return status;
+}
+
+static int
+_arb_fpwrap_double_airy_zero_vec(double * res, ulong n, int which, slong len, int flags)
+{
+    slong i;
+    int status = FPWRAP_SUCCESS;
+
+    for (i = 0; i < len; i++)
+        if (_arb_fpwrap_double_airy_zero(res + i, n + i, which, flags) != FPWRAP_SUCCESS)
+            status = FPWRAP_UNABLE;
+
+    return status;
+}
+
+int arb_fpwrap_double_airy_ai_zero_vec(double * res, ulong n, slong len, int flags) { return _arb_fpwrap_double_airy_zero_vec(res, n, 0, len, flags); }
+int arb_fpwrap_double_airy_ai_prime_zero_vec(double * res, ulong n, slong len, int flags) { return _arb_fpwrap_double_airy_zero_vec(res, n, 1, len, flags); }
+int arb_fpwrap_double_airy_bi_zero_vec(double * res, ulong n, slong len, int flags) { return _arb_fpwrap_double_airy_zero_vec(res, n, 2, len, flags); }
+int arb_fpwrap_double_airy_bi_prime_zero_vec(double * res, ulong n, slong len, int flags) { return _arb_fpwrap_double_airy_zero_vec(res, n, 3, len, flags); }
+
+int arb_fpwrap_cdouble_spherical_y_vec(complex_double * res, slong n, slong m, const complex_double * x1, const complex_double * x2, slong len, int flags)
+{
+    slong i;
+    int status = FPWRAP_SUCCESS;
+
+    for (i = 0; i < len; i++)
+        if (arb_fpwrap_cdouble_spherical_y(res + i, n, m, x1[i], x2[i], flags) != FPWRAP_SUCCESS)
+            status = FPWRAP_UNABLE;
+
+    return status;
+}
+
+int arb_fpwrap_double_hypgeom_pfq_vec(double * res, const double * a, slong p, const double * b, slong q, const double * z, int regularized, slong len, int flags)
+{
+    slong i;
+    int status = FPWRAP_SUCCESS;
+
+    for (i = 0; i < len; i++)
+        if (arb_fpwrap_double_hypgeom_pfq(res + i, a, p, b, q, z[i], regularized, flags) != FPWRAP_SUCCESS)
+            status = FPWRAP_UNABLE;
+
+    return status;
+}
+
+int arb_fpwrap_cdouble_hypgeom_pfq_vec(complex_double * res, const complex_double * a, slong p, const complex_double * b, slong q, const complex_double * z, int regularized, slong len, int flags)
+{
+    slong i;
+    int status = FPWRAP_SUCCESS;
+
+    for (i = 0; i < len; i++)
+        if (arb_fpwrap_cdouble_hypgeom_pfq(res + i, a, p, b, q, z[i], regularized, flags) != FPWRAP_SUCCESS)
+            status = FPWRAP_UNABLE;
+
+    return status;
+}
+
 /* todo: functions with multiple outputs */
 /* todo: elliptic invariants, roots */
 /* todo: eisenstein series */
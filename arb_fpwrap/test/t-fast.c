@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/double_extras.h"
+#include "arb_fpwrap.h"
+
+/* Exercises the double-double fast path over its whole input range
+   (and beyond), comparing with MPFR. */
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("fast....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000 * arb_test_multiplier(); iter++)
+    {
+        mpfr_t t;
+        double x, y, z;
+        int flags, status;
+
+        mpfr_init2(t, 53);
+
+        flags = n_randint(state, 2) ? 0 : FPWRAP_CORRECT_ROUNDING;
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                if (n_randint(state, 2))
+                    x = (d_randtest(state) - 0.5) * 1400.0;
+                else
+                    x = d_randtest2(state);
+                mpfr_set_d(t, x, MPFR_RNDN);
+                status = arb_fpwrap_double_exp(&y, x, flags);
+                mpfr_exp(t, t, MPFR_RNDN);
+                break;
+            case 1:
+                if (n_randint(state, 2))
+                    x = 1.0 + ldexp(d_randtest(state) - 0.5, -(slong) n_randint(state, 60));
+                else
+                    x = fabs(d_randtest2(state));
+                mpfr_set_d(t, x, MPFR_RNDN);
+                status = arb_fpwrap_double_log(&y, x, flags);
+                mpfr_log(t, t, MPFR_RNDN);
+                break;
+            default:
+                x = fabs(d_randtest2(state));
+                mpfr_set_d(t, x, MPFR_RNDN);
+                status = arb_fpwrap_double_sqrt(&y, x, flags);
+                mpfr_sqrt(t, t, MPFR_RNDN);
+                break;
+        }
+
+        z = mpfr_get_d(t, MPFR_RNDN);
+
+        if (status == FPWRAP_SUCCESS && z == z)
+        {
+            if ((flags & FPWRAP_CORRECT_ROUNDING) ? (z != y) :
+                    (fabs(z - y) > fabs(z) * 1e-15))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("flags = %d, x = %.17g, y = %.17g, z = %.17g\n\n", flags, x, y, z);
+                flint_abort();
+            }
+        }
+
+        mpfr_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
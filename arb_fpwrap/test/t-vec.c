@@ -0,0 +1,247 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/double_extras.h"
+#include "arb_fpwrap.h"
+
+static int
+d_same(double x, double y)
+{
+    return (x == y) || (x != x && y != y);
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        double *x, *y, *res, *res2;
+        complex_double *cx, *cres, *cres2;
+        slong i, len;
+        int flags, status, status2, s;
+
+        len = n_randint(state, 20);
+
+        x = flint_malloc(sizeof(double) * (len + 1));
+        y = flint_malloc(sizeof(double) * (len + 1));
+        res = flint_malloc(sizeof(double) * (len + 1));
+        res2 = flint_malloc(sizeof(double) * (len + 1));
+        cx = flint_malloc(sizeof(complex_double) * (len + 1));
+        cres = flint_malloc(sizeof(complex_double) * (len + 1));
+        cres2 = flint_malloc(sizeof(complex_double) * (len + 1));
+
+        for (i = 0; i < len; i++)
+        {
+            x[i] = d_randtest(state) * (n_randint(state, 2) ? 1 : -1) + n_randint(state, 10);
+            y[i] = d_randtest(state) + n_randint(state, 3);
+            cx[i].real = x[i];
+            cx[i].imag = y[i];
+
+            /* poles and non-finite input */
+            if (n_randint(state, 10) == 0)
+                x[i] = 0.0;
+            if (n_randint(state, 20) == 0)
+                y[i] = D_INF;
+        }
+
+        flags = n_randint(state, 2) ? 0 : FPWRAP_CORRECT_ROUNDING;
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                status = arb_fpwrap_double_log_vec(res, x, len, flags);
+                status2 = FPWRAP_SUCCESS;
+                for (i = 0; i < len; i++)
+                {
+                    s = arb_fpwrap_double_log(res2 + i, x[i], flags);
+                    status2 |= s;
+                }
+                break;
+            case 1:
+                status = arb_fpwrap_double_pow_vec(res, x, y, len, flags);
+                status2 = FPWRAP_SUCCESS;
+                for (i = 0; i < len; i++)
+                {
+                    s = arb_fpwrap_double_pow(res2 + i, x[i], y[i], flags);
+                    status2 |= s;
+                }
+                break;
+            case 2:
+                status = arb_fpwrap_double_gamma_upper_vec(res, y, x, 1, len, flags);
+                status2 = FPWRAP_SUCCESS;
+                for (i = 0; i < len; i++)
+                {
+                    s = arb_fpwrap_double_gamma_upper(res2 + i, y[i], x[i], 1, flags);
+                    status2 |= s;
+                }
+                break;
+            default:
+                status = arb_fpwrap_double_gamma_vec(res, x, len, flags);
+                status2 = FPWRAP_SUCCESS;
+                for (i = 0; i < len; i++)
+                {
+                    s = arb_fpwrap_double_gamma(res2 + i, x[i], flags);
+                    status2 |= s;
+                }
+                break;
+        }
+
+        if (status != status2)
+        {
+            flint_printf("FAIL: status\n\n");
+            flint_abort();
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            if (!d_same(res[i], res2[i]))
+            {
+                flint_printf("FAIL: value\n\n");
+                flint_printf("i = %wd, x = %.17g, y = %.17g, res = %.17g, res2 = %.17g\n\n",
+                    i, x[i], y[i], res[i], res2[i]);
+                flint_abort();
+            }
+        }
+
+        status = arb_fpwrap_cdouble_sin_vec(cres, cx, len, flags | FPWRAP_ACCURATE_PARTS);
+        status2 = FPWRAP_SUCCESS;
+        for (i = 0; i < len; i++)
+        {
+            s = arb_fpwrap_cdouble_sin(cres2 + i, cx[i], flags | FPWRAP_ACCURATE_PARTS);
+            status2 |= s;
+        }
+
+        if (status != status2)
+        {
+            flint_printf("FAIL: status (complex)\n\n");
+            flint_abort();
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            if (!d_same(cres[i].real, cres2[i].real) || !d_same(cres[i].imag, cres2[i].imag))
+            {
+                flint_printf("FAIL: value (complex)\n\n");
+                flint_abort();
+            }
+        }
+
+        flint_free(x);
+        flint_free(y);
+        flint_free(res);
+        flint_free(res2);
+        flint_free(cx);
+        flint_free(cres);
+        flint_free(cres2);
+    }
+
+    /* functions with integer parameters */
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        double x[8], res[8], res2[8], w[8], w2[8], a[2], b[2];
+        complex_double cx[8], cres[8], cres2[8];
+        slong i, len, branch;
+        ulong n;
+        int status, status2;
+
+        len = n_randint(state, 8);
+        branch = (slong) n_randint(state, 4) - 2;
+        n = 1 + n_randint(state, 20);
+
+        for (i = 0; i < 8; i++)
+        {
+            res[i] = res2[i] = w[i] = w2[i] = 0.0;
+            cres[i].real = cres[i].imag = cres2[i].real = cres2[i].imag = 0.0;
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            x[i] = d_randtest(state) * (n_randint(state, 2) ? 1 : -1) * n_randint(state, 4);
+            cx[i].real = x[i];
+            cx[i].imag = d_randtest(state);
+        }
+
+        a[0] = 0.5; a[1] = 1.5;
+        b[0] = 2.25; b[1] = -0.5;
+
+        switch (n_randint(state, 6))
+        {
+            case 0:
+                status = arb_fpwrap_double_lambertw_vec(res, x, branch, len, 0);
+                for (i = 0, status2 = FPWRAP_SUCCESS; i < len; i++)
+                    status2 |= arb_fpwrap_double_lambertw(res2 + i, x[i], branch, 0);
+                break;
+            case 1:
+                status = arb_fpwrap_double_airy_ai_zero_vec(res, n - 1, len, 0);
+                for (i = 0, status2 = FPWRAP_SUCCESS; i < len; i++)
+                    status2 |= arb_fpwrap_double_airy_ai_zero(res2 + i, n - 1 + i, 0);
+                break;
+            case 2:
+                status = arb_fpwrap_double_legendre_root_vec(res, w, n, n / 2, len, 0);
+                for (i = 0, status2 = FPWRAP_SUCCESS; i < len; i++)
+                    status2 |= arb_fpwrap_double_legendre_root(res2 + i, w2 + i, n, n / 2 + i, 0);
+                for (i = 0; i < len; i++)
+                {
+                    if (!d_same(w[i], w2[i]))
+                    {
+                        flint_printf("FAIL: weight (legendre_root)\n\n");
+                        flint_abort();
+                    }
+                }
+                break;
+            case 3:
+                status = arb_fpwrap_double_hypgeom_pfq_vec(res, a, 2, b, 1, x, 0, len, 0);
+                for (i = 0, status2 = FPWRAP_SUCCESS; i < len; i++)
+                    status2 |= arb_fpwrap_double_hypgeom_pfq(res2 + i, a, 2, b, 1, x[i], 0, 0);
+                break;
+            case 4:
+                status = arb_fpwrap_cdouble_lambertw_vec(cres, cx, branch, len, 0);
+                for (i = 0, status2 = FPWRAP_SUCCESS; i < len; i++)
+                    status2 |= arb_fpwrap_cdouble_lambertw(cres2 + i, cx[i], branch, 0);
+                break;
+            default:
+                status = arb_fpwrap_cdouble_spherical_y_vec(cres, n, branch, cx, cx, len, 0);
+                for (i = 0, status2 = FPWRAP_SUCCESS; i < len; i++)
+                    status2 |= arb_fpwrap_cdouble_spherical_y(cres2 + i, n, branch, cx[i], cx[i], 0);
+                break;
+        }
+
+        if (status != status2)
+        {
+            flint_printf("FAIL: status (integer parameters)\n\n");
+            flint_abort();
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            if (!d_same(res[i], res2[i]) ||
+                !d_same(cres[i].real, cres2[i].real) || !d_same(cres[i].imag, cres2[i].imag))
+            {
+                flint_printf("FAIL: value (integer parameters)\n\n");
+                flint_printf("i = %wd, x = %.17g\n\n", i, x[i]);
+                flint_abort();
+            }
+        }
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
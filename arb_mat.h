@@ -217,6 +217,12 @@ void _arb_mat_addmul_rad_mag_fast(arb_mat_t C, mag_srcptr A, mag_srcptr B, slong
 
 void arb_mat_mul_block(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec);
 
+int arb_mat_is_lagom(const arb_mat_t A);
+
+ARB_DLL extern slong arb_mat_mul_midrad_cutoff;
+
+void arb_mat_mul_midrad(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec);
+
 void arb_mat_mul_entrywise(arb_mat_t res, const arb_mat_t mat1, const arb_mat_t mat2, slong prec);
 
 void arb_mat_sqr_classical(arb_mat_t B, const arb_mat_t A, slong prec);
@@ -377,6 +383,21 @@ int arb_mat_solve_preapprox(arb_mat_t X, const arb_mat_t A,
     const arb_mat_t B, const arb_mat_t R, const arb_mat_t T, slong prec);
 
 void arb_mat_approx_mul(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec);
+int arb_mat_approx_mul_double(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec);
+/* Largest exponent spread within a row of A or a column of B accepted by
+   approx_mul_double. The scaled entries are at least 2^-449, so that their
+   products and the low parts and rounding errors of double-double
+   products (about 2^-106 times smaller) stay above 2^-1022, in the normal
+   range; wider inputs use the multiprecision code. */
+#define ARB_MAT_APPROX_D_MAX_SPREAD 448
+
+int _arb_mat_approx_d_update_exp(slong * emax, slong * emin, const arf_t x);
+void _arb_mat_approx_d_get(double * hi, double * lo, const arf_t x, slong e, arf_t t, arf_t u);
+void _arb_mat_approx_d_set(arf_t c, const double * hi, const double * lo,
+    slong e, arf_t t, arf_t u, slong prec);
+void _arb_mat_approx_gemm_d(double * C, const double * A, const double * B, slong ar, slong ac, slong bc);
+int _arb_mat_approx_gemm_dd(double * Chi, double * Clo, const double * Ahi, const double * Alo,
+    const double * Bhi, const double * Blo, slong ar, slong ac, slong bc);
 void arb_mat_approx_solve_triu(arb_mat_t X, const arb_mat_t U, const arb_mat_t B, int unit, slong prec);
 void arb_mat_approx_solve_tril(arb_mat_t X, const arb_mat_t L, const arb_mat_t B, int unit, slong prec);
 int arb_mat_approx_lu(slong * P, arb_mat_t LU, const arb_mat_t A, slong prec);
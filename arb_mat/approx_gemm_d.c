@@ -0,0 +1,304 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <float.h>
+#include "flint/thread_support.h"
+#include "arb_mat.h"
+
+/*
+Cache-blocked floating-point GEMM kernels C += A * B for the approximate
+matrix multiplication. All matrices are dense row-major arrays.
+
+The innermost loop runs along a row of B and a row of C with unit stride
+so that the compiler can vectorize it. Rows of C are distributed over
+threads in blocks; every entry is computed by the same sequence of
+operations regardless of the number of threads. In the double version,
+each entry is accumulated by recursive summation over increasing k;
+arb_mat_mul_midrad relies on this for its error bound.
+
+The double-double kernel relies on error-free transformations, which
+require that doubles are evaluated in double precision (not in x87
+extended precision) and that the compiler does not fuse them into FMA
+instructions.
+*/
+
+#define GEMM_BLOCK_I 32
+#define GEMM_BLOCK_K 128
+#define GEMM_BLOCK_J 512
+
+/* don't spawn threads for fewer multiplications than this */
+#define GEMM_THREAD_CUTOFF 200000.0
+
+#if defined(FLT_EVAL_METHOD)
+#define GEMM_EVAL_METHOD FLT_EVAL_METHOD
+#elif defined(__FLT_EVAL_METHOD__)
+#define GEMM_EVAL_METHOD __FLT_EVAL_METHOD__
+#else
+#define GEMM_EVAL_METHOD -1
+#endif
+
+#if (GEMM_EVAL_METHOD >= 0) && (GEMM_EVAL_METHOD != 2)
+#define GEMM_HAVE_DD 1
+#else
+#define GEMM_HAVE_DD 0
+#endif
+
+typedef struct
+{
+    double * Chi;
+    double * Clo;
+    const double * Ahi;
+    const double * Alo;
+    const double * Bhi;
+    const double * Blo;
+    const double * Bs1;
+    const double * Bs2;
+    slong ar;
+    slong ac;
+    slong bc;
+}
+_gemm_work_t;
+
+static void
+_gemm_d_block(const _gemm_work_t * w, slong i0, slong i1)
+{
+    slong i, j, k, j0, j1, k0, k1, ac, bc;
+    const double * b;
+    double * c;
+    double a;
+
+    ac = w->ac;
+    bc = w->bc;
+
+    for (j0 = 0; j0 < bc; j0 += GEMM_BLOCK_J)
+    {
+        j1 = FLINT_MIN(j0 + GEMM_BLOCK_J, bc);
+
+        for (k0 = 0; k0 < ac; k0 += GEMM_BLOCK_K)
+        {
+            k1 = FLINT_MIN(k0 + GEMM_BLOCK_K, ac);
+
+            for (i = i0; i < i1; i++)
+            {
+                c = w->Chi + i * bc;
+
+                for (k = k0; k < k1; k++)
+                {
+                    a = w->Ahi[i * ac + k];
+
+                    if (a == 0.0)
+                        continue;
+
+                    b = w->Bhi + k * bc;
+
+                    for (j = j0; j < j1; j++)
+                        c[j] += a * b[j];
+                }
+            }
+        }
+    }
+}
+
+static void
+_gemm_d_worker(slong t, _gemm_work_t * w)
+{
+    _gemm_d_block(w, t * GEMM_BLOCK_I, FLINT_MIN((t + 1) * GEMM_BLOCK_I, w->ar));
+}
+
+static void
+_gemm_run(_gemm_work_t * w, do_func_t worker)
+{
+    slong num_blocks;
+
+    num_blocks = (w->ar + GEMM_BLOCK_I - 1) / GEMM_BLOCK_I;
+
+    if (num_blocks > 1 && flint_get_num_threads() > 1 &&
+        (double) w->ar * w->ac * w->bc > GEMM_THREAD_CUTOFF)
+    {
+        flint_parallel_do(worker, w, num_blocks, -1, FLINT_PARALLEL_DYNAMIC);
+    }
+    else
+    {
+        slong t;
+
+        for (t = 0; t < num_blocks; t++)
+            worker(t, w);
+    }
+}
+
+void
+_arb_mat_approx_gemm_d(double * C, const double * A, const double * B,
+    slong ar, slong ac, slong bc)
+{
+    _gemm_work_t w;
+
+    if (ar == 0 || ac == 0 || bc == 0)
+        return;
+
+    w.Chi = C;
+    w.Clo = NULL;
+    w.Ahi = A;
+    w.Alo = NULL;
+    w.Bhi = B;
+    w.Blo = NULL;
+    w.Bs1 = NULL;
+    w.Bs2 = NULL;
+    w.ar = ar;
+    w.ac = ac;
+    w.bc = bc;
+
+    _gemm_run(&w, (do_func_t) _gemm_d_worker);
+}
+
+#if GEMM_HAVE_DD
+
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+#define DD_SPLITTER 134217729.0     /* 2^27 + 1 */
+
+static void
+_gemm_dd_block(const _gemm_work_t * w, slong i0, slong i1)
+{
+    slong i, j, k, j0, j1, k0, k1, ac, bc;
+    const double *bh, *bl, *b1, *b2;
+    double *ch, *cl;
+    double ah, al, a1, a2, t;
+    double p, e, s, v;
+
+    ac = w->ac;
+    bc = w->bc;
+
+    for (j0 = 0; j0 < bc; j0 += GEMM_BLOCK_J)
+    {
+        j1 = FLINT_MIN(j0 + GEMM_BLOCK_J, bc);
+
+        for (k0 = 0; k0 < ac; k0 += GEMM_BLOCK_K)
+        {
+            k1 = FLINT_MIN(k0 + GEMM_BLOCK_K, ac);
+
+            for (i = i0; i < i1; i++)
+            {
+                ch = w->Chi + i * bc;
+                cl = w->Clo + i * bc;
+
+                for (k = k0; k < k1; k++)
+                {
+                    ah = w->Ahi[i * ac + k];
+                    al = w->Alo[i * ac + k];
+
+                    if (ah == 0.0)
+                        continue;
+
+                    /* Veltkamp splitting of ah */
+                    t = DD_SPLITTER * ah;
+                    a1 = t - (t - ah);
+                    a2 = ah - a1;
+
+                    bh = w->Bhi + k * bc;
+                    bl = w->Blo + k * bc;
+                    b1 = w->Bs1 + k * bc;
+                    b2 = w->Bs2 + k * bc;
+
+                    for (j = j0; j < j1; j++)
+                    {
+                        /* p + e = ah * bh exactly (Dekker) */
+                        p = ah * bh[j];
+                        e = ((a1 * b1[j] - p) + a1 * b2[j] + a2 * b1[j]) + a2 * b2[j];
+                        e += ah * bl[j] + al * bh[j];
+
+                        /* s + v = ch + p exactly (Knuth) */
+                        s = ch[j] + p;
+                        t = s - ch[j];
+                        v = (ch[j] - (s - t)) + (p - t);
+                        v += cl[j] + e;
+
+                        /* renormalize */
+                        ch[j] = s + v;
+                        cl[j] = v - (ch[j] - s);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void
+_gemm_dd_worker(slong t, _gemm_work_t * w)
+{
+    _gemm_dd_block(w, t * GEMM_BLOCK_I, FLINT_MIN((t + 1) * GEMM_BLOCK_I, w->ar));
+}
+
+int
+_arb_mat_approx_gemm_dd(double * Chi, double * Clo,
+    const double * Ahi, const double * Alo,
+    const double * Bhi, const double * Blo,
+    slong ar, slong ac, slong bc)
+{
+    _gemm_work_t w;
+    double * Bs;
+    double t;
+    slong i;
+
+    if (ar == 0 || ac == 0 || bc == 0)
+        return 1;
+
+    /* split B once instead of in the inner loop */
+    Bs = flint_malloc(sizeof(double) * 2 * ac * bc);
+
+    for (i = 0; i < ac * bc; i++)
+    {
+        t = DD_SPLITTER * Bhi[i];
+        Bs[i] = t - (t - Bhi[i]);
+        Bs[ac * bc + i] = Bhi[i] - Bs[i];
+    }
+
+    w.Chi = Chi;
+    w.Clo = Clo;
+    w.Ahi = Ahi;
+    w.Alo = Alo;
+    w.Bhi = Bhi;
+    w.Blo = Blo;
+    w.Bs1 = Bs;
+    w.Bs2 = Bs + ac * bc;
+    w.ar = ar;
+    w.ac = ac;
+    w.bc = bc;
+
+    _gemm_run(&w, (do_func_t) _gemm_dd_worker);
+
+    flint_free(Bs);
+
+    return 1;
+}
+
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT DEFAULT
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#else
+
+int
+_arb_mat_approx_gemm_dd(double * Chi, double * Clo,
+    const double * Ahi, const double * Alo,
+    const double * Bhi, const double * Blo,
+    slong ar, slong ac, slong bc)
+{
+    return 0;
+}
+
+#endif
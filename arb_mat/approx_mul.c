@@ -11,6 +11,8 @@
 
 #include "arb_mat.h"
 
+#define APPROX_MUL_DOUBLE_CUTOFF 4
+
 void
 arb_mat_approx_mul_classical(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
 {
@@ -58,10 +60,11 @@ arb_mat_approx_mul_classical(arb_mat_t C, const arb_mat_t A, const arb_mat_t B,
     else
     {
         arb_ptr tmp;
-        TMP_INIT;
+        arb_arena_struct * arena;
 
-        TMP_START;
-        tmp = TMP_ALLOC(sizeof(arb_struct) * br * bc);
+        arena = _arb_arena_thread();
+        arb_arena_push(arena);
+        tmp = arb_arena_alloc(arena, sizeof(arb_struct) * br * bc);
 
         for (i = 0; i < br; i++)
             for (j = 0; j < bc; j++)
@@ -76,7 +79,7 @@ arb_mat_approx_mul_classical(arb_mat_t C, const arb_mat_t A, const arb_mat_t B,
             }
         }
 
-        TMP_END;
+        arb_arena_pop(arena);
     }
 }
 
@@ -85,6 +88,15 @@ arb_mat_approx_mul(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec
 {
     slong cutoff;
 
+    /* use hardware floating-point arithmetic at low precision */
+    if (prec <= 106 && arb_mat_nrows(A) >= APPROX_MUL_DOUBLE_CUTOFF &&
+        arb_mat_ncols(A) >= APPROX_MUL_DOUBLE_CUTOFF &&
+        arb_mat_ncols(B) >= APPROX_MUL_DOUBLE_CUTOFF &&
+        arb_mat_approx_mul_double(C, A, B, prec))
+    {
+        return;
+    }
+
     /* todo: detect small-integer matrices */
     if (prec <= 2 * FLINT_BITS)
         cutoff = 120;
@@ -0,0 +1,142 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_mat.h"
+
+int
+arb_mat_approx_mul_double(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
+{
+    slong ar, ac, bc, i, j, emin;
+    slong *ea, *eb;
+    double *Ahi, *Alo, *Bhi, *Blo, *Chi, *Clo;
+    int dd, success;
+    arf_t t, u;
+
+    ar = arb_mat_nrows(A);
+    ac = arb_mat_ncols(A);
+    bc = arb_mat_ncols(B);
+
+    if (prec > 106)
+        return 0;
+
+    dd = (prec > 53);
+
+    if (ac == 0)
+    {
+        arb_mat_zero(C);
+        return 1;
+    }
+
+    if (ar == 0 || bc == 0)
+        return 1;
+
+    ea = flint_malloc(sizeof(slong) * (ar + bc));
+    eb = ea + ar;
+
+    success = 1;
+
+    /* row exponents of A and column exponents of B */
+    for (i = 0; i < ar && success; i++)
+    {
+        ea[i] = WORD_MIN;
+        emin = WORD_MAX;
+
+        for (j = 0; j < ac && success; j++)
+            success = _arb_mat_approx_d_update_exp(ea + i, &emin,
+                arb_midref(arb_mat_entry(A, i, j)));
+
+        if (ea[i] != WORD_MIN && ea[i] - emin > ARB_MAT_APPROX_D_MAX_SPREAD)
+            success = 0;
+    }
+
+    for (j = 0; j < bc && success; j++)
+    {
+        eb[j] = WORD_MIN;
+        emin = WORD_MAX;
+
+        for (i = 0; i < ac && success; i++)
+            success = _arb_mat_approx_d_update_exp(eb + j, &emin,
+                arb_midref(arb_mat_entry(B, i, j)));
+
+        if (eb[j] != WORD_MIN && eb[j] - emin > ARB_MAT_APPROX_D_MAX_SPREAD)
+            success = 0;
+    }
+
+    if (!success)
+    {
+        flint_free(ea);
+        return 0;
+    }
+
+    Ahi = flint_malloc(sizeof(double) * (dd ? 2 : 1) * (ar * ac + ac * bc + ar * bc));
+    Bhi = Ahi + ar * ac;
+    Chi = Bhi + ac * bc;
+    Alo = Blo = Clo = NULL;
+
+    if (dd)
+    {
+        Alo = Chi + ar * bc;
+        Blo = Alo + ar * ac;
+        Clo = Blo + ac * bc;
+    }
+
+    arf_init(t);
+    arf_init(u);
+
+    for (i = 0; i < ar; i++)
+        for (j = 0; j < ac; j++)
+            _arb_mat_approx_d_get(Ahi + i * ac + j, dd ? Alo + i * ac + j : NULL,
+                arb_midref(arb_mat_entry(A, i, j)), ea[i], t, u);
+
+    for (i = 0; i < ac; i++)
+        for (j = 0; j < bc; j++)
+            _arb_mat_approx_d_get(Bhi + i * bc + j, dd ? Blo + i * bc + j : NULL,
+                arb_midref(arb_mat_entry(B, i, j)), eb[j], t, u);
+
+    for (i = 0; i < ar * bc; i++)
+    {
+        Chi[i] = 0.0;
+        if (dd)
+            Clo[i] = 0.0;
+    }
+
+    if (dd)
+        success = _arb_mat_approx_gemm_dd(Chi, Clo, Ahi, Alo, Bhi, Blo, ar, ac, bc);
+    else
+        _arb_mat_approx_gemm_d(Chi, Ahi, Bhi, ar, ac, bc);
+
+    if (success)
+    {
+        for (i = 0; i < ar; i++)
+        {
+            for (j = 0; j < bc; j++)
+            {
+                arf_ptr c = arb_midref(arb_mat_entry(C, i, j));
+
+                if (ea[i] == WORD_MIN || eb[j] == WORD_MIN)
+                {
+                    arf_zero(c);
+                    continue;
+                }
+
+                _arb_mat_approx_d_set(c, Chi + i * bc + j,
+                    dd ? Clo + i * bc + j : NULL, ea[i] + eb[j], t, u, prec);
+            }
+        }
+    }
+
+    arf_clear(t);
+    arf_clear(u);
+    flint_free(Ahi);
+    flint_free(ea);
+
+    return success;
+}
@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_mat.h"
+
+/* Conversions between arf midpoints and scaled double or double-double
+   numbers, shared by arb_mat_approx_mul_double and
+   acb_mat_approx_mul_double. */
+
+int
+_arb_mat_approx_d_update_exp(slong * emax, slong * emin, const arf_t x)
+{
+    slong e;
+
+    if (arf_is_special(x))
+        return arf_is_zero(x);
+
+    if (COEFF_IS_MPZ(*ARF_EXPREF(x)))
+        return 0;
+
+    e = *ARF_EXPREF(x);
+
+    if (e >= COEFF_MAX / 4 || e <= COEFF_MIN / 4)
+        return 0;
+
+    *emax = FLINT_MAX(*emax, e);
+    *emin = FLINT_MIN(*emin, e);
+    return 1;
+}
+
+void
+_arb_mat_approx_d_get(double * hi, double * lo, const arf_t x, slong e, arf_t t, arf_t u)
+{
+    if (arf_is_zero(x))
+    {
+        *hi = 0.0;
+        if (lo != NULL)
+            *lo = 0.0;
+        return;
+    }
+
+    arf_mul_2exp_si(t, x, -e);
+    *hi = arf_get_d(t, ARF_RND_NEAR);
+
+    if (lo != NULL)
+    {
+        arf_set_d(u, *hi);
+        arf_sub(u, t, u, 53, ARF_RND_NEAR);
+        *lo = arf_get_d(u, ARF_RND_NEAR);
+    }
+}
+
+void
+_arb_mat_approx_d_set(arf_t c, const double * hi, const double * lo,
+    slong e, arf_t t, arf_t u, slong prec)
+{
+    if (lo != NULL)
+    {
+        arf_set_d(t, *hi);
+        arf_set_d(u, *lo);
+        arf_add(c, t, u, prec, ARB_RND);
+    }
+    else
+    {
+        arf_set_d(c, *hi);
+        arf_set_round(c, c, prec, ARB_RND);
+    }
+
+    arf_mul_2exp_si(c, c, e);
+}
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "arb_mat.h"
 
 static void
@@ -17,21 +18,21 @@ arb_approx_div(arb_t z, const arb_t x, const arb_t y, slong prec)
     arf_div(arb_midref(z), arb_midref(x), arb_midref(y), prec, ARB_RND);
 }
 
-void
-arb_mat_approx_solve_tril_classical(arb_mat_t X,
-        const arb_mat_t L, const arb_mat_t B, int unit, slong prec)
+static void
+_arb_mat_approx_solve_tril_classical(arb_mat_t X,
+        const arb_mat_t L, const arb_mat_t B, int unit,
+    slong col_start, slong col_end, slong prec)
 {
-    slong i, j, n, m;
+    slong i, j, n;
     arb_ptr tmp;
     arb_t s;
 
     n = L->r;
-    m = B->c;
 
     arb_init(s);
     tmp = flint_malloc(sizeof(arb_struct) * n);
 
-    for (i = 0; i < m; i++)
+    for (i = col_start; i < col_end; i++)
     {
         for (j = 0; j < n; j++)
             tmp[j] = *arb_mat_entry(X, j, i);
@@ -54,6 +55,62 @@ arb_mat_approx_solve_tril_classical(arb_mat_t X,
     arb_clear(s);
 }
 
+typedef struct
+{
+    arb_mat_struct * X;
+    const arb_mat_struct * L;
+    const arb_mat_struct * B;
+    int unit;
+    slong chunk;
+    slong prec;
+}
+_arb_mat_approx_solve_tril_classical_work_t;
+
+static void
+_arb_mat_approx_solve_tril_classical_worker(slong i, _arb_mat_approx_solve_tril_classical_work_t * work)
+{
+    slong m = arb_mat_ncols(work->B);
+
+    _arb_mat_approx_solve_tril_classical(work->X, work->L, work->B, work->unit,
+        i * work->chunk, FLINT_MIN((i + 1) * work->chunk, m), work->prec);
+}
+
+void
+arb_mat_approx_solve_tril_classical(arb_mat_t X, const arb_mat_t L,
+    const arb_mat_t B, int unit, slong prec)
+{
+    slong n, m, num_threads;
+
+    n = L->r;
+    m = B->c;
+    num_threads = flint_get_num_threads();
+
+    /* the columns are independent */
+    if (num_threads > 1 && m > 1 && (double) n * n * m * prec > 1e6)
+    {
+        _arb_mat_approx_solve_tril_classical_work_t work;
+        slong num_chunks;
+
+        num_chunks = FLINT_MIN(m, 4 * num_threads);
+
+        work.X = X;
+        work.L = L;
+        work.B = B;
+        work.unit = unit;
+        work.chunk = (m + num_chunks - 1) / num_chunks;
+        work.prec = prec;
+
+        num_chunks = (m + work.chunk - 1) / work.chunk;
+
+        flint_parallel_do((do_func_t) _arb_mat_approx_solve_tril_classical_worker, &work,
+            num_chunks, -1, FLINT_PARALLEL_DYNAMIC);
+    }
+    else
+    {
+        _arb_mat_approx_solve_tril_classical(X, L, B, unit, 0, m, prec);
+    }
+}
+
 void
 arb_mat_approx_solve_tril_recursive(arb_mat_t X,
         const arb_mat_t L, const arb_mat_t B, int unit, slong prec)
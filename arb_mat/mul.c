@@ -40,6 +40,13 @@ arb_mat_mul(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
             arb_mat_mul_classical(C, A, B, prec);
         }
     }
+    else if (arb_mat_nrows(A) >= arb_mat_mul_midrad_cutoff &&
+             arb_mat_ncols(A) >= arb_mat_mul_midrad_cutoff &&
+             arb_mat_ncols(B) >= arb_mat_mul_midrad_cutoff &&
+             !(arb_mat_is_exact(A) && arb_mat_is_exact(B)))
+    {
+        arb_mat_mul_midrad(C, A, B, prec);
+    }
     else
     {
         arb_mat_mul_block(C, A, B, prec);
@@ -9,8 +9,12 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "arb_mat.h"
 
+/* minimum tile size when splitting the product between threads */
+#define MUL_BLOCK_MIN_TILE 16
+
 int arb_mat_is_lagom(const arb_mat_t A)
 {
     slong i, j, M, N;
@@ -33,19 +37,22 @@ int arb_mat_is_lagom(const arb_mat_t A)
 /* allow changing this from the test code */
 ARB_DLL slong arb_mat_mul_block_min_block_size = 0;
 
-void
-arb_mat_mid_addmul_block_fallback(arb_mat_t C,
+/* The midpoint products below operate on the rows [M0, M1) and the
+   columns [P0, P1) of C, so that disjoint tiles of C can be processed
+   in parallel. */
+static void
+_arb_mat_mid_addmul_block_fallback(arb_mat_t C,
     const arb_mat_t A, const arb_mat_t B,
-    slong block_start,
-    slong block_end,
+    slong block_start, slong block_end,
+    slong M0, slong M1, slong P0, slong P1,
     slong prec)
 {
     slong M, P, n;
     slong i, j;
     arb_ptr tmpA, tmpB;
 
-    M = arb_mat_nrows(A);
-    P = arb_mat_ncols(B);
+    M = M1 - M0;
+    P = P1 - P0;
 
     n = block_end - block_start;
 
@@ -56,7 +63,7 @@ arb_mat_mid_addmul_block_fallback(arb_mat_t C,
     {
         for (j = 0; j < n; j++)
         {
-            *arb_midref(tmpA + i * n + j) = *arb_midref(arb_mat_entry(A, i, block_start + j));
+            *arb_midref(tmpA + i * n + j) = *arb_midref(arb_mat_entry(A, M0 + i, block_start + j));
             mag_init(arb_radref(tmpA + i * n + j));
         }
     }
@@ -65,7 +72,7 @@ arb_mat_mid_addmul_block_fallback(arb_mat_t C,
     {
         for (j = 0; j < n; j++)
         {
-            *arb_midref(tmpB + i * n + j) = *arb_midref(arb_mat_entry(B, block_start + j, i));
+            *arb_midref(tmpB + i * n + j) = *arb_midref(arb_mat_entry(B, block_start + j, P0 + i));
             mag_init(arb_radref(tmpB + i * n + j));
         }
     }
@@ -74,8 +81,8 @@ arb_mat_mid_addmul_block_fallback(arb_mat_t C,
     {
         for (j = 0; j < P; j++)
         {
-            arb_dot(arb_mat_entry(C, i, j),
-                (block_start == 0) ? NULL : arb_mat_entry(C, i, j), 0,
+            arb_dot(arb_mat_entry(C, M0 + i, P0 + j),
+                (block_start == 0) ? NULL : arb_mat_entry(C, M0 + i, P0 + j), 0,
                 tmpA + i * n, 1, tmpB + j * n, 1, n, prec);
         }
     }
@@ -83,11 +90,11 @@ arb_mat_mid_addmul_block_fallback(arb_mat_t C,
     flint_free(tmpA);
 }
 
-void
-arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
+static void
+_arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
     const arb_mat_t A, const arb_mat_t B,
-    slong block_start,
-    slong block_end,
+    slong block_start, slong block_end,
+    slong Mlo, slong Mhi, slong Plo, slong Phi,
     const slong * A_min,  /* A per-row bottom exponent */
     const slong * B_min,  /* B per-row bottom exponent */
     slong prec)
@@ -99,8 +106,8 @@ arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
 
     /* flint_printf("block mul from %wd to %wd\n", block_start, block_end); */
 
-    M = arb_mat_nrows(A);
-    P = arb_mat_ncols(B);
+    M = Mhi - Mlo;
+    P = Phi - Plo;
 
     n = block_end - block_start;
 
@@ -113,17 +120,16 @@ arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
     Pstep = P;
 #endif
 
-    for (M0 = 0; M0 < M; M0 += Mstep)
+    for (M0 = Mlo; M0 < Mhi; M0 += Mstep)
     {
-        for (P0 = 0; P0 < P; P0 += Pstep)
+        for (P0 = Plo; P0 < Phi; P0 += Pstep)
         {
             fmpz_mat_t AA, BB, CC;
             arb_t t;
             fmpz_t e;
 
-            M1 = FLINT_MIN(M0 + Mstep, M);
-            P1 = FLINT_MIN(P0 + Pstep, P);
-
+            M1 = FLINT_MIN(M0 + Mstep, Mhi);
+            P1 = FLINT_MIN(P0 + Pstep, Phi);
             fmpz_mat_init(AA, M1 - M0, n);
             fmpz_mat_init(BB, n, P1 - P0);
             fmpz_mat_init(CC, M1 - M0, P1 - P0);
@@ -202,6 +208,78 @@ arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
     }
 }
 
+void
+arb_mat_mid_addmul_block_fallback(arb_mat_t C,
+    const arb_mat_t A, const arb_mat_t B,
+    slong block_start,
+    slong block_end,
+    slong prec)
+{
+    _arb_mat_mid_addmul_block_fallback(C, A, B, block_start, block_end,
+        0, arb_mat_nrows(A), 0, arb_mat_ncols(B), prec);
+}
+
+void
+arb_mat_mid_addmul_block_prescaled(arb_mat_t C,
+    const arb_mat_t A, const arb_mat_t B,
+    slong block_start,
+    slong block_end,
+    const slong * A_min,  /* A per-row bottom exponent */
+    const slong * B_min,  /* B per-row bottom exponent */
+    slong prec)
+{
+    _arb_mat_mid_addmul_block_prescaled(C, A, B, block_start, block_end,
+        0, arb_mat_nrows(A), 0, arb_mat_ncols(B), A_min, B_min, prec);
+}
+
+/* Exponent blocks are determined first; the midpoint product is then
+   computed tile by tile, each tile of C accumulating the contributions
+   of all blocks in order. The tiles are independent, and the result
+   does not depend on the tiling or on the number of threads. */
+typedef struct
+{
+    arb_mat_struct * C;
+    const arb_mat_struct * A;
+    const arb_mat_struct * B;
+    slong num_blocks;
+    const slong * block_start;
+    const slong * block_end;
+    const int * block_prescaled;
+    const slong * A_min;
+    const slong * B_min;
+    slong Mstep;
+    slong Pstep;
+    slong Ptiles;
+    slong prec;
+}
+_arb_mat_mul_block_work_t;
+
+static void
+_arb_mat_mul_block_worker(slong i, _arb_mat_mul_block_work_t * work)
+{
+    slong b, M, P, M0, M1, P0, P1;
+
+    M = arb_mat_nrows(work->A);
+    P = arb_mat_ncols(work->B);
+
+    M0 = (i / work->Ptiles) * work->Mstep;
+    P0 = (i % work->Ptiles) * work->Pstep;
+    M1 = FLINT_MIN(M0 + work->Mstep, M);
+    P1 = FLINT_MIN(P0 + work->Pstep, P);
+
+    for (b = 0; b < work->num_blocks; b++)
+    {
+        if (work->block_prescaled[b])
+            _arb_mat_mid_addmul_block_prescaled(work->C, work->A, work->B,
+                work->block_start[b], work->block_end[b], M0, M1, P0, P1,
+                work->A_min + b * M, work->B_min + b * P, work->prec);
+        else
+            _arb_mat_mid_addmul_block_fallback(work->C, work->A, work->B,
+                work->block_start[b], work->block_end[b], M0, M1, P0, P1,
+                work->prec);
+    }
+}
+
 /* todo: squaring optimizations */
 void
 arb_mat_mul_block(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
@@ -213,6 +291,9 @@ arb_mat_mul_block(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
     slong block_start, block_end, i, j, bot, top, max_height;
     slong b, A_max_bits, B_max_bits;
     slong min_block_size;
+    slong num_blocks, alloc_blocks, Mstep, Pstep, num_threads;
+    slong *blocks_start, *blocks_end, *blocks_A_min, *blocks_B_min;
+    int *blocks_prescaled;
     arb_srcptr t;
     int A_exact, B_exact;
     double A_density, B_density;
@@ -345,6 +426,10 @@ arb_mat_mul_block(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
     else
         min_block_size = 30;
 
+    num_blocks = alloc_blocks = 0;
+    blocks_start = blocks_end = blocks_A_min = blocks_B_min = NULL;
+    blocks_prescaled = NULL;
+
     block_start = 0;
     while (block_start < N)
     {
@@ -441,22 +526,87 @@ arb_mat_mul_block(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
         }
 
     blocks_built:
+        if (num_blocks == alloc_blocks)
+        {
+            alloc_blocks = FLINT_MAX(4, 2 * alloc_blocks);
+            blocks_start = flint_realloc(blocks_start, sizeof(slong) * alloc_blocks);
+            blocks_end = flint_realloc(blocks_end, sizeof(slong) * alloc_blocks);
+            blocks_prescaled = flint_realloc(blocks_prescaled, sizeof(int) * alloc_blocks);
+            blocks_A_min = flint_realloc(blocks_A_min, sizeof(slong) * alloc_blocks * M);
+            blocks_B_min = flint_realloc(blocks_B_min, sizeof(slong) * alloc_blocks * P);
+        }
+
         if (block_end - block_start < min_block_size)
         {
             block_end = FLINT_MIN(N, block_start + min_block_size);
-
-            arb_mat_mid_addmul_block_fallback(C, A, B,
-                block_start, block_end, prec);
+            blocks_prescaled[num_blocks] = 0;
         }
         else
         {
-            arb_mat_mid_addmul_block_prescaled(C, A, B,
-                block_start, block_end, A_min, B_min, prec);
+            blocks_prescaled[num_blocks] = 1;
+            for (i = 0; i < M; i++)
+                blocks_A_min[num_blocks * M + i] = A_min[i];
+            for (i = 0; i < P; i++)
+                blocks_B_min[num_blocks * P + i] = B_min[i];
         }
 
+        blocks_start[num_blocks] = block_start;
+        blocks_end[num_blocks] = block_end;
+        num_blocks++;
+
         block_start = block_end;
     }
 
+    /* Split C into enough tiles to keep all threads busy. */
+    Mstep = M;
+    Pstep = P;
+    num_threads = flint_get_num_threads();
+
+    if (num_threads > 1)
+    {
+        while (((M + Mstep - 1) / Mstep) * ((P + Pstep - 1) / Pstep) < 4 * num_threads
+            && FLINT_MAX(Mstep, Pstep) >= 2 * MUL_BLOCK_MIN_TILE)
+        {
+            if (Mstep >= Pstep)
+                Mstep = (Mstep + 1) / 2;
+            else
+                Pstep = (Pstep + 1) / 2;
+        }
+    }
+
+    {
+        _arb_mat_mul_block_work_t work;
+        slong num_tiles;
+
+        work.C = C;
+        work.A = A;
+        work.B = B;
+        work.num_blocks = num_blocks;
+        work.block_start = blocks_start;
+        work.block_end = blocks_end;
+        work.block_prescaled = blocks_prescaled;
+        work.A_min = blocks_A_min;
+        work.B_min = blocks_B_min;
+        work.Mstep = Mstep;
+        work.Pstep = Pstep;
+        work.Ptiles = (P + Pstep - 1) / Pstep;
+        work.prec = prec;
+
+        num_tiles = ((M + Mstep - 1) / Mstep) * work.Ptiles;
+
+        if (num_tiles == 1)
+            _arb_mat_mul_block_worker(0, &work);
+        else
+            flint_parallel_do((do_func_t) _arb_mat_mul_block_worker, &work,
+                num_tiles, -1, FLINT_PARALLEL_DYNAMIC);
+    }
+
+    flint_free(blocks_start);
+    flint_free(blocks_end);
+    flint_free(blocks_prescaled);
+    flint_free(blocks_A_min);
+    flint_free(blocks_B_min);
+
     flint_free(A_bot);
     flint_free(A_max);
     flint_free(A_min);
@@ -73,10 +73,11 @@ arb_mat_mul_classical(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong p
     else
     {
         arb_ptr tmp;
-        TMP_INIT;
+        arb_arena_struct * arena;
 
-        TMP_START;
-        tmp = TMP_ALLOC(sizeof(arb_struct) * br * bc);
+        arena = _arb_arena_thread();
+        arb_arena_push(arena);
+        tmp = arb_arena_alloc(arena, sizeof(arb_struct) * br * bc);
 
         for (i = 0; i < br; i++)
             for (j = 0; j < bc; j++)
@@ -91,6 +92,6 @@ arb_mat_mul_classical(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong p
             }
         }
 
-        TMP_END;
+        arb_arena_pop(arena);
     }
 }
@@ -0,0 +1,270 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_mat.h"
+
+/* arb_mat_mul uses arb_mat_mul_midrad only when this is set lower;
+   the default disables it */
+ARB_DLL slong arb_mat_mul_midrad_cutoff = WORD_MAX;
+
+/* Entries smaller than 2^-MIDRAD_MIN_EXP relative to the row or column
+   scale are replaced by 2^-MIDRAD_MIN_EXP, so that no conversion to
+   double underflows. */
+#define MIDRAD_MIN_EXP 1000
+
+/* We use WORD_MIN to represent zero here. */
+static __inline__ slong
+_mag_get_exp(const mag_t x)
+{
+    if (mag_is_special(x))
+        return WORD_MIN;
+    else
+        return MAG_EXP(x);
+}
+
+/* Upper bound for x / 2^e, assuming x <= 2^e and small exponents. */
+static __inline__ double
+_mag_get_d_fixed_upper(const mag_t x, slong e)
+{
+    if (mag_is_zero(x))
+        return 0.0;
+
+    if (MAG_EXP(x) - e < -MIDRAD_MIN_EXP)
+        return ldexp(1.0, -MIDRAD_MIN_EXP);
+
+    /* exact, since the mantissa has MAG_BITS < 53 bits */
+    return ldexp(MAG_MAN(x), MAG_EXP(x) - e - MAG_BITS);
+}
+
+/*
+Adds to the radii of C an upper bound for the product of the
+nonnegative M x N matrix A and the N x P matrix B, given as linear
+arrays in row-major order with small exponents.
+
+Row i of A is scaled by 2^(-ea[i]) and column j of B by 2^(-eb[j]),
+so that all entries are at most 1, and the scaled product is computed in
+double precision with round-to-nearest. The floating-point kernel computes
+each entry by recursive summation, so for nonnegative data the exact
+result is bounded by the computed one times (1 + 2.01 (N + 1) 2^-52), plus
+an absolute term for underflow.
+*/
+static void
+_arb_mat_addmul_rad_d(arb_mat_t C, mag_srcptr A, mag_srcptr B,
+    slong M, slong N, slong P)
+{
+    slong i, j, e;
+    slong *ea, *eb;
+    double *AA, *BB, *CC;
+    double eps, tiny, c;
+
+    ea = flint_malloc(sizeof(slong) * (M + P));
+    eb = ea + M;
+
+    for (i = 0; i < M; i++)
+    {
+        ea[i] = WORD_MIN;
+        for (j = 0; j < N; j++)
+        {
+            e = _mag_get_exp(A + i * N + j);
+            ea[i] = FLINT_MAX(ea[i], e);
+        }
+    }
+
+    for (j = 0; j < P; j++)
+    {
+        eb[j] = WORD_MIN;
+        for (i = 0; i < N; i++)
+        {
+            e = _mag_get_exp(B + i * P + j);
+            eb[j] = FLINT_MAX(eb[j], e);
+        }
+    }
+
+    AA = flint_malloc(sizeof(double) * (M * N + N * P + M * P));
+    BB = AA + M * N;
+    CC = BB + N * P;
+
+    for (i = 0; i < M; i++)
+        for (j = 0; j < N; j++)
+            AA[i * N + j] = _mag_get_d_fixed_upper(A + i * N + j, ea[i]);
+
+    for (i = 0; i < N; i++)
+        for (j = 0; j < P; j++)
+            BB[i * P + j] = _mag_get_d_fixed_upper(B + i * P + j, eb[j]);
+
+    for (i = 0; i < M * P; i++)
+        CC[i] = 0.0;
+
+    _arb_mat_approx_gemm_d(CC, AA, BB, M, N, P);
+
+    eps = ldexp(1.0, -52);
+    tiny = ldexp((double) (N + 1), -1070);
+
+    for (i = 0; i < M; i++)
+    {
+        if (ea[i] == WORD_MIN)  /* only zeros in this row */
+            continue;
+
+        for (j = 0; j < P; j++)
+        {
+            mag_t t;
+
+            if (eb[j] == WORD_MIN)  /* only zeros in this column */
+                continue;
+
+            c = CC[i * P + j];
+            c = c * (1.0 + 2.01 * (N + 1) * eps) + tiny;
+
+            MAG_SET_D_2EXP(MAG_MAN(t), MAG_EXP(t), c, ea[i] + eb[j]);
+            mag_add(arb_radref(arb_mat_entry(C, i, j)),
+                    arb_radref(arb_mat_entry(C, i, j)), t);
+        }
+    }
+
+    flint_free(AA);
+    flint_free(ea);
+}
+
+void
+arb_mat_mul_midrad(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
+{
+    slong M, N, P, i, j;
+    int A_exact, B_exact;
+    mag_ptr AA, BB;
+
+    M = arb_mat_nrows(A);
+    N = arb_mat_ncols(A);
+    P = arb_mat_ncols(B);
+
+    if (N != arb_mat_nrows(B) || M != arb_mat_nrows(C) || P != arb_mat_ncols(C))
+    {
+        flint_printf("arb_mat_mul_midrad: incompatible dimensions\n");
+        flint_abort();
+    }
+
+    if (M == 0 || N == 0 || P == 0)
+    {
+        arb_mat_zero(C);
+        return;
+    }
+
+    if (A == C || B == C)
+    {
+        arb_mat_t T;
+        arb_mat_init(T, M, P);
+        arb_mat_mul_midrad(T, A, B, prec);
+        arb_mat_swap_entrywise(T, C);
+        arb_mat_clear(T);
+        return;
+    }
+
+    /* We assume below that exponents cannot overflow/underflow
+       the small fmpz value range. */
+    if (!arb_mat_is_lagom(A) || !arb_mat_is_lagom(B))
+    {
+        arb_mat_mul_classical(C, A, B, prec);
+        return;
+    }
+
+    A_exact = arb_mat_is_exact(A);
+    B_exact = arb_mat_is_exact(B);
+
+    /* Midpoint product */
+    if (A_exact && B_exact)
+    {
+        arb_mat_mul(C, A, B, prec);
+        return;
+    }
+    else
+    {
+        arb_mat_t AM, BM;
+
+        arb_mat_init(AM, M, N);
+        arb_mat_init(BM, N, P);
+        arb_mat_get_mid(AM, A);
+        arb_mat_get_mid(BM, B);
+        arb_mat_mul(C, AM, BM, prec);
+        arb_mat_clear(AM);
+        arb_mat_clear(BM);
+    }
+
+    /* Radius product. With A = Am + Ar and B = Bm + Br, we have
+       |AB - Am Bm| <= |Am| Br + Ar (|Bm| + Br), which we compute
+       as a single product of an M x 2N and a 2N x P matrix
+       (with only one half when A or B is exact). Shallow mag_structs
+       are fine since exponents are small. */
+    if (A_exact)
+    {
+        AA = flint_malloc(sizeof(mag_struct) * M * N);
+        BB = flint_malloc(sizeof(mag_struct) * N * P);
+
+        for (i = 0; i < M; i++)
+            for (j = 0; j < N; j++)
+                mag_fast_init_set_arf(AA + i * N + j,
+                    arb_midref(arb_mat_entry(A, i, j)));
+
+        for (i = 0; i < N; i++)
+            for (j = 0; j < P; j++)
+                BB[i * P + j] = *arb_radref(arb_mat_entry(B, i, j));
+
+        _arb_mat_addmul_rad_d(C, AA, BB, M, N, P);
+    }
+    else if (B_exact)
+    {
+        AA = flint_malloc(sizeof(mag_struct) * M * N);
+        BB = flint_malloc(sizeof(mag_struct) * N * P);
+
+        for (i = 0; i < M; i++)
+            for (j = 0; j < N; j++)
+                AA[i * N + j] = *arb_radref(arb_mat_entry(A, i, j));
+
+        for (i = 0; i < N; i++)
+            for (j = 0; j < P; j++)
+                mag_fast_init_set_arf(BB + i * P + j,
+                    arb_midref(arb_mat_entry(B, i, j)));
+
+        _arb_mat_addmul_rad_d(C, AA, BB, M, N, P);
+    }
+    else
+    {
+        AA = flint_malloc(sizeof(mag_struct) * M * 2 * N);
+        BB = flint_malloc(sizeof(mag_struct) * 2 * N * P);
+
+        /* [|Am|, Ar] */
+        for (i = 0; i < M; i++)
+        {
+            for (j = 0; j < N; j++)
+            {
+                mag_fast_init_set_arf(AA + i * 2 * N + j,
+                    arb_midref(arb_mat_entry(A, i, j)));
+                AA[i * 2 * N + N + j] = *arb_radref(arb_mat_entry(A, i, j));
+            }
+        }
+
+        /* [Br; |Bm| + Br] */
+        for (i = 0; i < N; i++)
+        {
+            for (j = 0; j < P; j++)
+            {
+                BB[i * P + j] = *arb_radref(arb_mat_entry(B, i, j));
+                mag_fast_init_set_arf(BB + (N + i) * P + j,
+                    arb_midref(arb_mat_entry(B, i, j)));
+                mag_add(BB + (N + i) * P + j, BB + (N + i) * P + j,
+                    arb_radref(arb_mat_entry(B, i, j)));
+            }
+        }
+
+        _arb_mat_addmul_rad_d(C, AA, BB, M, 2 * N, P);
+    }
+
+    flint_free(AA);
+    flint_free(BB);
+}
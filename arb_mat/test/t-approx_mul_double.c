@@ -0,0 +1,146 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_mat.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("approx_mul_double....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 2000 * arb_test_multiplier(); iter++)
+    {
+        arb_mat_t A, B, C;
+        arb_t s, t, err;
+        slong m, n, p, i, j, k, prec, shift;
+        int success;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        p = n_randint(state, 30);
+        prec = 2 + n_randint(state, 130);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        arb_mat_init(A, m, n);
+        arb_mat_init(B, n, p);
+        arb_mat_init(C, m, p);
+        arb_init(s);
+        arb_init(t);
+        arb_init(err);
+
+        arb_mat_randtest(A, state, 2 + n_randint(state, 200), 5);
+        arb_mat_randtest(B, state, 2 + n_randint(state, 200), 5);
+        arb_mat_randtest(C, state, 2 + n_randint(state, 200), 5);
+
+        /* rows and columns of very different magnitude */
+        for (i = 0; i < m; i++)
+        {
+            shift = n_randint(state, 2) ? 0 : (slong) n_randint(state, 1000000) - 500000;
+            for (k = 0; k < n; k++)
+                arb_mul_2exp_si(arb_mat_entry(A, i, k), arb_mat_entry(A, i, k), shift);
+        }
+
+        for (j = 0; j < p; j++)
+        {
+            shift = n_randint(state, 2) ? 0 : (slong) n_randint(state, 1000000) - 500000;
+            for (k = 0; k < n; k++)
+                arb_mul_2exp_si(arb_mat_entry(B, k, j), arb_mat_entry(B, k, j), shift);
+        }
+
+        success = arb_mat_approx_mul_double(C, A, B, prec);
+
+        if (success != (prec <= 106))
+        {
+            flint_printf("FAIL (success)\n\n");
+            flint_printf("prec = %wd, success = %d\n\n", prec, success);
+            flint_abort();
+        }
+
+        for (i = 0; i < m && success; i++)
+        {
+            for (j = 0; j < p; j++)
+            {
+                /* s = exact product, err = sum of absolute values */
+                arb_zero(s);
+                arb_zero(err);
+
+                for (k = 0; k < n; k++)
+                {
+                    arf_mul(arb_midref(t), arb_midref(arb_mat_entry(A, i, k)),
+                        arb_midref(arb_mat_entry(B, k, j)), ARF_PREC_EXACT, ARF_RND_DOWN);
+                    arb_add(s, s, t, ARF_PREC_EXACT);
+                    arb_abs(t, t);
+                    arb_add(err, err, t, 30);
+                }
+
+                arb_mul_si(err, err, n + 2, 30);
+                arb_mul_2exp_si(err, err, 2 - prec);
+                arb_add_error(s, err);
+
+                if (!arb_contains_arf(s, arb_midref(arb_mat_entry(C, i, j))))
+                {
+                    flint_printf("FAIL (accuracy)\n\n");
+                    flint_printf("m = %wd, n = %wd, p = %wd, prec = %wd, i = %wd, j = %wd\n\n",
+                        m, n, p, prec, i, j);
+                    flint_printf("A = "); arb_mat_printd(A, 30); flint_printf("\n\n");
+                    flint_printf("B = "); arb_mat_printd(B, 30); flint_printf("\n\n");
+                    flint_printf("C = "); arb_mat_printd(C, 30); flint_printf("\n\n");
+                    flint_printf("s = "); arb_printd(s, 30); flint_printf("\n\n");
+                    flint_abort();
+                }
+            }
+        }
+
+        arb_mat_clear(A);
+        arb_mat_clear(B);
+        arb_mat_clear(C);
+        arb_clear(s);
+        arb_clear(t);
+        arb_clear(err);
+    }
+
+    /* an exponent spread that would underflow the scaled products */
+    {
+        arb_mat_t A, B, C;
+
+        arb_mat_init(A, 1, 2);
+        arb_mat_init(B, 2, 1);
+        arb_mat_init(C, 1, 1);
+
+        arb_one(arb_mat_entry(A, 0, 0));
+        arb_one(arb_mat_entry(A, 0, 1));
+        arb_mul_2exp_si(arb_mat_entry(A, 0, 1), arb_mat_entry(A, 0, 1), -500);
+        arb_one(arb_mat_entry(B, 0, 0));
+        arb_one(arb_mat_entry(B, 1, 0));
+
+        if (arb_mat_approx_mul_double(C, A, B, 53))
+        {
+            flint_printf("FAIL (spread)\n\n");
+            flint_abort();
+        }
+
+        arb_mat_clear(A);
+        arb_mat_clear(B);
+        arb_mat_clear(C);
+    }
+
+    flint_set_num_threads(1);
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -44,6 +44,7 @@ int main()
         n = n_randint(state, 20);
         m = n_randint(state, 20);
         prec = 2 + n_randint(state, 200);
+        flint_set_num_threads(1 + n_randint(state, 3));
 
         arb_mat_init(A, n, m);
         arb_mat_init(LU, n, m);
@@ -76,6 +77,7 @@ int main()
         n = n_randint(state, 20);
         qbits = 1 + n_randint(state, 100);
         prec = 2 + n_randint(state, 202);
+        flint_set_num_threads(1 + n_randint(state, 3));
 
         fmpq_mat_init(Q, n, n);
         arb_mat_init(A, n, n);
@@ -170,6 +172,7 @@ int main()
         _perm_clear(perm);
     }
 
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
@@ -112,7 +112,7 @@ int main()
 
     for (iter = 0; iter < 2000 * arb_test_multiplier(); iter++)
     {
-        arb_mat_t A, B, C, D;
+        arb_mat_t A, B, C, D, E;
         slong m, n, p, bits1, bits2, exp1, exp2, prec1, prec2;
 
         m = n_randint(state, 40);
@@ -140,11 +140,13 @@ int main()
         arb_mat_init(B, n, p);
         arb_mat_init(C, m, p);
         arb_mat_init(D, m, p);
+        arb_mat_init(E, m, p);
 
         arb_mat_randtest(A, state, bits1, exp1);
         arb_mat_randtest(B, state, bits2, exp2);
         arb_mat_randtest(C, state, bits2, exp2);
 
+        flint_set_num_threads(1 + n_randint(state, 4));
         arb_mat_mul_block(C, A, B, prec1);
         arb_mat_mul_classical(D, A, B, prec2);
 
@@ -155,10 +157,22 @@ int main()
             flint_abort();
         }
 
+        /* the result must not depend on the number of threads */
+        flint_set_num_threads(1);
+        arb_mat_mul_block(E, A, B, prec1);
+
+        if (!arb_mat_equal(C, E))
+        {
+            flint_printf("FAIL (threads)\n");
+            flint_printf("m = %wd, n = %wd, p = %wd\n", m, n, p);
+            flint_abort();
+        }
+
         arb_mat_clear(A);
         arb_mat_clear(B);
         arb_mat_clear(C);
         arb_mat_clear(D);
+        arb_mat_clear(E);
     }
 
     flint_randclear(state);
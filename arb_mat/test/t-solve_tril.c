@@ -28,6 +28,7 @@ int main()
         int unit;
 
         prec = 2 + n_randint(state, 200);
+        flint_set_num_threads(1 + n_randint(state, 3));
         if (n_randint(state, 10) == 0)
         {
             rows = n_randint(state, 60);
@@ -99,6 +100,7 @@ int main()
         arb_mat_clear(Y);
     }
 
+    flint_set_num_threads(1);
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
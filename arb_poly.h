@@ -349,6 +349,27 @@ void _arb_poly_tree_free(arb_ptr * tree, slong len);
 
 void _arb_poly_tree_build(arb_ptr * tree, arb_srcptr roots, slong len, slong prec);
 
+typedef struct
+{
+    arb_ptr * tree;
+    arb_ptr * inv;
+    arb_ptr weights;
+    slong len;
+}
+arb_poly_tree_struct;
+
+typedef arb_poly_tree_struct arb_poly_tree_t[1];
+
+arb_ptr * _arb_poly_tree_inverses_alloc(slong len);
+
+void _arb_poly_tree_inverses_free(arb_ptr * inv, slong len);
+
+void _arb_poly_tree_inverses(arb_ptr * inv, arb_ptr * tree, slong len, slong prec);
+
+void arb_poly_tree_init(arb_poly_tree_t T, arb_srcptr xs, slong len, slong prec);
+
+void arb_poly_tree_clear(arb_poly_tree_t T);
+
 /* Composition */
 
 void _arb_poly_taylor_shift_horner(arb_ptr poly, const arb_t c, slong n, slong prec);
@@ -395,6 +416,13 @@ void arb_poly_compose_series_horner(arb_poly_t res,
                     const arb_poly_t poly1,
                     const arb_poly_t poly2, slong n, slong prec);
 
+void _arb_poly_compose_series_kinoshita_li(arb_ptr res, arb_srcptr poly1, slong len1,
+                            arb_srcptr poly2, slong len2, slong n, slong prec);
+
+void arb_poly_compose_series_kinoshita_li(arb_poly_t res,
+                    const arb_poly_t poly1,
+                    const arb_poly_t poly2, slong n, slong prec);
+
 void _arb_poly_compose_series(arb_ptr res, arb_srcptr poly1, slong len1,
                             arb_srcptr poly2, slong len2, slong n, slong prec);
 
@@ -448,6 +476,9 @@ void arb_poly_evaluate_vec_iter(arb_ptr ys,
 void _arb_poly_evaluate_vec_fast_precomp(arb_ptr vs, arb_srcptr poly,
     slong plen, arb_ptr * tree, slong len, slong prec);
 
+void _arb_poly_evaluate_vec_fast_precomp_inv(arb_ptr vs, arb_srcptr poly,
+    slong plen, arb_ptr * tree, arb_ptr * inv, slong len, slong prec);
+
 void _arb_poly_evaluate_vec_fast(arb_ptr ys, arb_srcptr poly, slong plen,
     arb_srcptr xs, slong n, slong prec);
 
@@ -480,6 +511,18 @@ void _arb_poly_interpolate_fast(arb_ptr poly,
 void arb_poly_interpolate_fast(arb_poly_t poly,
         arb_srcptr xs, arb_srcptr ys, slong n, slong prec);
 
+void _arb_poly_tree_evaluate_vec(arb_ptr ys, arb_srcptr poly, slong plen,
+    const arb_poly_tree_t T, slong prec);
+
+void arb_poly_tree_evaluate_vec(arb_ptr ys, const arb_poly_t poly,
+    const arb_poly_tree_t T, slong prec);
+
+void _arb_poly_tree_interpolate(arb_ptr poly, arb_srcptr ys,
+    const arb_poly_tree_t T, slong prec);
+
+void arb_poly_tree_interpolate(arb_poly_t poly, arb_srcptr ys,
+    const arb_poly_tree_t T, slong prec);
+
 /* Derivative and integral */
 
 void _arb_poly_derivative(arb_ptr res, arb_srcptr poly, slong len, slong prec);
@@ -0,0 +1,333 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+
+/*
+Composition using the algorithm of Kinoshita and Li, in the form of
+the transpose of power projection. With Q(x,y) = 1 - y g(x), power
+projection computes [x^(n-1)] P(x,y) / Q(x,y) mod y^m by repeated Graeffe
+steps Q(x,y) Q(-x,y) = V(x^2,y), which halve the length in x and
+double the degree in y. Each step multiplies the numerator by Q(-x,y)
+and keeps the coefficients of one parity. Running the numerator steps
+in reverse order with transposed products gives f(g(x)) mod x^n, using
+O(log n) products of length O(n).
+
+Bivariate polynomials are stored with x as the outer index, the
+coefficient of x^i y^j being at position i * stride + j, and are
+multiplied by Kronecker substitution.
+*/
+
+/* {res, n} = {a, alen} * {b, blen} for any lengths and any n */
+static void
+_mullow_any(arb_ptr res, arb_srcptr a, slong alen,
+    arb_srcptr b, slong blen, slong n, slong prec)
+{
+    slong len;
+
+    if (alen < blen)
+    {
+        arb_srcptr t = a; a = b; b = t;
+        len = alen; alen = blen; blen = len;
+    }
+
+    len = FLINT_MIN(n, alen + blen - 1);
+    _arb_poly_mullow(res, a, FLINT_MIN(alen, len), b, FLINT_MIN(blen, len), len, prec);
+    _arb_vec_zero(res + len, n - len);
+}
+
+/* Shallow Kronecker packing of the ax x ay polynomial a, with entries
+   of the result of length len at i * Z + j (or len - 1 - (i * Z + j)
+   when reversed). Entries not covered by a are shallow copies of zero;
+   the result must be released with flint_free. */
+static arb_ptr
+_pack(arb_srcptr a, slong ax, slong ay, slong astride,
+    slong Z, slong len, int reverse, const arb_t zero)
+{
+    arb_ptr u;
+    slong i, j, k;
+
+    u = flint_malloc(sizeof(arb_struct) * len);
+
+    for (k = 0; k < len; k++)
+        u[k] = *zero;
+
+    for (i = 0; i < ax; i++)
+    {
+        for (j = 0; j < ay; j++)
+        {
+            k = i * Z + j;
+            if (k < len)
+                u[reverse ? len - 1 - k : k] = a[i * astride + j];
+        }
+    }
+
+    return u;
+}
+
+/* out = a * b mod (x^ox, y^oy) */
+static void
+_bivariate_mullow(arb_ptr out, slong ostride, slong ox, slong oy,
+    arb_srcptr a, slong astride, slong ax, slong ay,
+    arb_srcptr b, slong bstride, slong bx, slong by, slong prec)
+{
+    arb_ptr u, v, p;
+    arb_t zero;
+    slong i, j, Z, L, ulen, vlen;
+
+    ax = FLINT_MIN(ax, ox);
+    bx = FLINT_MIN(bx, ox);
+
+    Z = ay + by - 1;
+    L = ox * Z;
+    ulen = (ax - 1) * Z + ay;
+    vlen = (bx - 1) * Z + by;
+
+    arb_init(zero);
+    p = _arb_vec_init(L);
+
+    u = _pack(a, ax, ay, astride, Z, ulen, 0, zero);
+
+    if (a == b && astride == bstride && ax == bx && ay == by)
+    {
+        _mullow_any(p, u, ulen, u, ulen, L, prec);
+        v = NULL;
+    }
+    else
+    {
+        v = _pack(b, bx, by, bstride, Z, vlen, 0, zero);
+        _mullow_any(p, u, ulen, v, vlen, L, prec);
+    }
+
+    for (i = 0; i < ox; i++)
+    {
+        for (j = 0; j < oy; j++)
+        {
+            if (j < Z)
+                arb_swap(out + i * ostride + j, p + i * Z + j);
+            else
+                arb_zero(out + i * ostride + j);
+        }
+    }
+
+    flint_free(u);
+    flint_free(v);
+    _arb_vec_clear(p, L);
+    arb_clear(zero);
+}
+
+/* Transposed product: out[a][b] = sum_{c,d} w[a+c][b+d] q[c][d]
+   for a < ox, b < oy. */
+static void
+_bivariate_mullow_transposed(arb_ptr out, slong ostride, slong ox, slong oy,
+    arb_srcptr w, slong wstride, slong wx, slong wy,
+    arb_srcptr q, slong qstride, slong qx, slong qy, slong prec)
+{
+    arb_ptr u, v, p;
+    arb_t zero;
+    slong i, j, Z, L, rx, vlen;
+
+    rx = FLINT_MIN(ox, wx);
+    qx = FLINT_MIN(qx, wx);
+
+    for (i = rx; i < ox; i++)
+        _arb_vec_zero(out + i * ostride, oy);
+
+    if (rx == 0)
+        return;
+
+    Z = FLINT_MAX(wy, oy + qy - 1);
+    L = wx * Z;
+    vlen = (qx - 1) * Z + qy;
+
+    arb_init(zero);
+    p = _arb_vec_init(L);
+
+    u = _pack(w, wx, wy, wstride, Z, L, 1, zero);
+    v = _pack(q, qx, qy, qstride, Z, vlen, 0, zero);
+    _mullow_any(p, u, L, v, vlen, L, prec);
+
+    for (i = 0; i < rx; i++)
+        for (j = 0; j < oy; j++)
+            arb_swap(out + i * ostride + j, p + L - 1 - (i * Z + j));
+
+    flint_free(u);
+    flint_free(v);
+    _arb_vec_clear(p, L);
+    arb_clear(zero);
+}
+
+void
+_arb_poly_compose_series_kinoshita_li(arb_ptr res,
+    arb_srcptr poly1, slong len1,
+    arb_srcptr poly2, slong len2, slong n, slong prec)
+{
+    arb_ptr Q[FLINT_BITS + 1];
+    slong nn[FLINT_BITS + 1], ee[FLINT_BITS + 1], dd[FLINT_BITS + 1];
+    arb_ptr R, S, h, B;
+    slong i, k, K, m, nk, n1, e, e1, d, d1, s, p, q, delta, na, nq;
+
+    m = len1;
+
+    if (m == 1 || n == 1)
+    {
+        if (m == 1)
+            arb_set_round(res, poly1, prec);
+        else
+            _arb_poly_evaluate(res, poly1, len1, poly2, prec);
+        _arb_vec_zero(res + 1, n - 1);
+        return;
+    }
+
+    /* Q_0 = 1 - y g(x) */
+    nn[0] = n;
+    ee[0] = 1;
+    dd[0] = 1;
+    Q[0] = _arb_vec_init(2 * n);
+    arb_one(Q[0]);
+    for (i = 0; i < FLINT_MIN(len2, n); i++)
+        arb_neg(Q[0] + 2 * i + 1, poly2 + i);
+
+    /* Graeffe steps Q_{k+1}(x^2,y) = Q_k(x,y) Q_k(-x,y), where the
+       right side equals Qe(x^2,y)^2 - x^2 Qo(x^2,y)^2 */
+    for (k = 0; nn[k] > 1; k++)
+    {
+        nk = nn[k];
+        e = ee[k];
+        n1 = (nk + 1) / 2;
+        e1 = FLINT_MIN(2 * e, m - 1);
+
+        Q[k + 1] = _arb_vec_init(n1 * (e1 + 1));
+
+        _bivariate_mullow(Q[k + 1], e1 + 1, n1, e1 + 1,
+            Q[k], 2 * (e + 1), (nk + 1) / 2, e + 1,
+            Q[k], 2 * (e + 1), (nk + 1) / 2, e + 1, prec);
+
+        if (n1 > 1)
+        {
+            B = _arb_vec_init((n1 - 1) * (e1 + 1));
+            _bivariate_mullow(B, e1 + 1, n1 - 1, e1 + 1,
+                Q[k] + e + 1, 2 * (e + 1), nk / 2, e + 1,
+                Q[k] + e + 1, 2 * (e + 1), nk / 2, e + 1, prec);
+            _arb_vec_sub(Q[k + 1] + e1 + 1, Q[k + 1] + e1 + 1, B,
+                (n1 - 1) * (e1 + 1), prec);
+            _arb_vec_clear(B, (n1 - 1) * (e1 + 1));
+        }
+
+        nn[k + 1] = n1;
+        ee[k + 1] = e1;
+        dd[k + 1] = FLINT_MIN(m, dd[k] + e);
+    }
+
+    K = k;
+
+    /* transpose of the final step, multiplication by 1/Q_K(0,y) mod y^m */
+    h = _arb_vec_init(m);
+    _arb_poly_inv_series(h, Q[K], ee[K] + 1, m, prec);
+    R = _arb_vec_init(dd[K]);
+    _bivariate_mullow_transposed(R, dd[K], 1, dd[K],
+        poly1, m, 1, m, h, m, 1, m, prec);
+    _arb_vec_clear(h, m);
+
+    /* transposes of the numerator steps P -> P(x,y) Q_k(-x,y), keeping
+       the coefficients of x^(2i+s); the output rows of each parity are
+       transposed products of R with the even or odd part of Q_k */
+    for (k = K - 1; k >= 0; k--)
+    {
+        nk = nn[k];
+        n1 = nn[k + 1];
+        e = ee[k];
+        d = dd[k];
+        d1 = dd[k + 1];
+        s = (nk - 1) % 2;
+
+        S = _arb_vec_init(nk * d);
+
+        for (p = 0; p < 2; p++)
+        {
+            q = (s + p) % 2;
+            delta = (p + q - s) / 2;
+            na = (nk - p + 1) / 2;
+            nq = (nk - q + 1) / 2;
+
+            _bivariate_mullow_transposed(S + p * d, 2 * d, na, d,
+                R + delta * d1, d1, n1 - delta, d1,
+                Q[k] + q * (e + 1), 2 * (e + 1), nq, e + 1, prec);
+
+            if (q == 1)
+                for (i = 0; i < na; i++)
+                    _arb_vec_neg(S + (2 * i + p) * d, S + (2 * i + p) * d, d);
+        }
+
+        _arb_vec_clear(R, n1 * d1);
+        _arb_vec_clear(Q[k + 1], nn[k + 1] * (ee[k + 1] + 1));
+        R = S;
+    }
+
+    for (i = 0; i < n; i++)
+        arb_swap(res + i, R + n - 1 - i);
+
+    _arb_vec_clear(R, n);
+    _arb_vec_clear(Q[0], 2 * n);
+}
+
+void
+arb_poly_compose_series_kinoshita_li(arb_poly_t res,
+                    const arb_poly_t poly1,
+                    const arb_poly_t poly2, slong n, slong prec)
+{
+    slong len1 = poly1->length;
+    slong len2 = poly2->length;
+    slong lenr;
+
+    if (len2 != 0 && !arb_is_zero(poly2->coeffs))
+    {
+        flint_printf("exception: compose_series: inner "
+                "polynomial must have zero constant term\n");
+        flint_abort();
+    }
+
+    if (len1 == 0 || n == 0)
+    {
+        arb_poly_zero(res);
+        return;
+    }
+
+    if (len2 == 0 || len1 == 1)
+    {
+        arb_poly_set_arb(res, poly1->coeffs);
+        return;
+    }
+
+    lenr = FLINT_MIN((len1 - 1) * (len2 - 1) + 1, n);
+    len1 = FLINT_MIN(len1, lenr);
+    len2 = FLINT_MIN(len2, lenr);
+
+    if ((res != poly1) && (res != poly2))
+    {
+        arb_poly_fit_length(res, lenr);
+        _arb_poly_compose_series_kinoshita_li(res->coeffs, poly1->coeffs, len1,
+                                        poly2->coeffs, len2, lenr, prec);
+        _arb_poly_set_length(res, lenr);
+        _arb_poly_normalise(res);
+    }
+    else
+    {
+        arb_poly_t t;
+        arb_poly_init2(t, lenr);
+        _arb_poly_compose_series_kinoshita_li(t->coeffs, poly1->coeffs, len1,
+                                        poly2->coeffs, len2, lenr, prec);
+        _arb_poly_set_length(t, lenr);
+        _arb_poly_normalise(t);
+        arb_poly_swap(res, t);
+        arb_poly_clear(t);
+    }
+}
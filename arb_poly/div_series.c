@@ -65,10 +65,14 @@ _arb_poly_div_series(arb_ptr Q, arb_srcptr A, slong Alen,
     else
     {
         arb_ptr Binv;
-        Binv = _arb_vec_init(n);
+        arb_arena_struct * arena;
+
+        arena = _arb_arena_thread();
+        arb_arena_push(arena);
+        Binv = _arb_arena_vec_init(arena, n);
         _arb_poly_inv_series(Binv, B, Blen, n, prec);
         _arb_poly_mullow(Q, Binv, n, A, Alen, n, prec);
-        _arb_vec_clear(Binv, n);
+        arb_arena_pop(arena);
     }
 }
 
@@ -42,20 +42,28 @@ _arb_poly_exp_series_basecase(arb_ptr f,
 
     if (n < 20 || hlen < 0.9 * n || prec <= 2 * FLINT_BITS || n < 1000.0 / log(prec + 10) - 70)
     {
-        arb_ptr t = _arb_vec_init(hlen);
+        arb_ptr t;
+        arb_arena_struct * arena;
+
+        arena = _arb_arena_thread();
+        arb_arena_push(arena);
+        t = _arb_arena_vec_init(arena, hlen);
         _arb_poly_exp_series_basecase_rec(f, t, h, hlen, n, prec);
-        _arb_vec_clear(t, hlen);
+        arb_arena_pop(arena);
     }
     else
     {
         slong m, v;
         arb_ptr t, u;
+        arb_arena_struct * arena;
 
         m = (n + 2) / 3;
         v = m * 2;
 
-        t = _arb_vec_init(n);
-        u = _arb_vec_init(n - m);
+        arena = _arb_arena_thread();
+        arb_arena_push(arena);
+        t = _arb_arena_vec_init(arena, n);
+        u = _arb_arena_vec_init(arena, n - m);
 
         _arb_poly_mullow(t, h + m, hlen - m, h + m, hlen - m, n - v, prec);
         _arb_vec_scalar_mul_2exp_si(t, t, n - v, -1);
@@ -66,8 +74,7 @@ _arb_poly_exp_series_basecase(arb_ptr f,
         _arb_poly_mullow(t, f, n, u, n - m, n - m, prec);
         _arb_poly_add(f + m, f + m, n - m, t, n - m, prec);
 
-        _arb_vec_clear(t, n);
-        _arb_vec_clear(u, n - m);
+        arb_arena_pop(arena);
     }
 }
 
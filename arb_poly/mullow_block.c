@@ -10,6 +10,7 @@
 */
 
 #include <math.h>
+#include "flint/thread_support.h"
 #include "arb_poly.h"
 
 void
@@ -82,6 +83,250 @@ _arb_poly_get_scale(fmpz_t scale, arb_srcptr x, slong xlen,
    numbers of size (2^(-DOUBLE_BLOCK_SHIFT))^2 must not underflow. */
 #define DOUBLE_BLOCK_SHIFT (DOUBLE_BLOCK_MAX_HEIGHT / 2)
 
+/* Block products where both factors have at least this length
+   are split into pieces which are multiplied on different threads. */
+#define THREADED_BLOCK_MIN_LENGTH 256
+
+/* Minimum length of the pieces. */
+#define THREADED_PIECE_MIN_LENGTH 64
+
+/* Number of output coefficients handled by one accumulation task. */
+#define THREADED_ACC_CHUNK 256
+
+/*
+Threaded block products. The integer product of a pair of blocks is
+split into a grid of smaller products which are computed in parallel
+and then added together exactly, so the result does not depend on the
+number of threads. The accumulation of the product into the output
+(which rounds) is distributed by output coefficient, each coefficient
+receiving its terms in the same order as in the serial code.
+*/
+
+typedef struct
+{
+    const fmpz * x;
+    const fmpz * y;
+    slong xl;
+    slong yl;
+    slong n;
+    slong xstep;
+    slong ystep;
+    slong ynum;
+    int squaring;
+    fmpz ** buf;
+    slong * off;
+    slong * len;
+}
+_block_pieces_t;
+
+static void
+_block_pieces_worker(slong i, _block_pieces_t * w)
+{
+    slong xa, ya, lx, ly, m;
+
+    xa = (i / w->ynum) * w->xstep;
+    ya = (i % w->ynum) * w->ystep;
+    lx = FLINT_MIN(w->xstep, w->xl - xa);
+    ly = FLINT_MIN(w->ystep, w->yl - ya);
+
+    w->off[i] = xa + ya;
+    w->len[i] = 0;
+
+    if (lx <= 0 || ly <= 0 || xa + ya >= w->n)
+        return;
+
+    m = FLINT_MIN(lx + ly - 1, w->n - xa - ya);
+    lx = FLINT_MIN(lx, m);
+    ly = FLINT_MIN(ly, m);
+
+    w->buf[i] = _fmpz_vec_init(m);
+    w->len[i] = m;
+
+    if (w->squaring && xa == ya && lx == ly)
+        _fmpz_poly_sqrlow(w->buf[i], w->x + xa, lx, m);
+    else if (lx >= ly)
+        _fmpz_poly_mullow(w->buf[i], w->x + xa, lx, w->y + ya, ly, m);
+    else
+        _fmpz_poly_mullow(w->buf[i], w->y + ya, ly, w->x + xa, lx, m);
+}
+
+#define ACC_MID 0
+#define ACC_RAD 1
+#define ACC_RAD_DOUBLE 2
+
+typedef struct
+{
+    arb_ptr z;
+    fmpz * zz;
+    const fmpz * zexp;
+    fmpz * const * buf;
+    const slong * off;
+    const slong * len;
+    slong num;
+    const double * xdbl;
+    const double * ydbl;
+    slong xl;
+    slong yl;
+    slong bn;
+    int mode;
+    slong prec;
+}
+_block_acc_t;
+
+static void
+_block_acc_worker(slong c, _block_acc_t * w)
+{
+    slong i, k, k0, k1, a, b, ii;
+    mag_t t;
+
+    k0 = c * THREADED_ACC_CHUNK;
+    k1 = FLINT_MIN(k0 + THREADED_ACC_CHUNK, w->bn);
+
+    if (w->mode == ACC_RAD_DOUBLE)
+    {
+        mag_init(t);
+
+        for (k = k0; k < k1; k++)
+        {
+            double ss = 0.0;
+
+            for (ii = FLINT_MAX(0, k - w->yl + 1);
+                ii <= FLINT_MIN(w->xl - 1, k); ii++)
+            {
+                ss += w->xdbl[ii] * w->ydbl[k - ii];
+            }
+
+            ss *= DOUBLE_ROUNDING_FACTOR;
+
+            mag_set_d_2exp_fmpz(t, ss, w->zexp);
+            mag_add(arb_radref(w->z + k), arb_radref(w->z + k), t);
+        }
+
+        mag_clear(t);
+        return;
+    }
+
+    /* exact sum of the pieces */
+    for (k = k0; k < k1; k++)
+        fmpz_zero(w->zz + k);
+
+    for (i = 0; i < w->num; i++)
+    {
+        a = FLINT_MAX(k0, w->off[i]);
+        b = FLINT_MIN(k1, w->off[i] + w->len[i]);
+
+        for (k = a; k < b; k++)
+            fmpz_add(w->zz + k, w->zz + k, w->buf[i] + k - w->off[i]);
+    }
+
+    if (w->mode == ACC_MID)
+    {
+        for (k = k0; k < k1; k++)
+            arb_add_fmpz_2exp(w->z + k, w->z + k, w->zz + k, w->zexp, w->prec);
+    }
+    else
+    {
+        mag_init(t);
+
+        for (k = k0; k < k1; k++)
+        {
+            mag_set_fmpz_2exp_fmpz(t, w->zz + k, w->zexp);
+            mag_add(arb_radref(w->z + k), arb_radref(w->z + k), t);
+        }
+
+        mag_clear(t);
+    }
+}
+
+/* Adds the product of the blocks x (length xl) and y (length yl),
+   truncated to length bn and multiplied by 2^zexp, to z, using
+   threads. For the double radius products, x and y are not used. */
+static void
+_arb_poly_addmullow_block_threaded(arb_ptr z, fmpz * zz, const fmpz * zexp,
+    const fmpz * x, const double * xdbl, slong xl,
+    const fmpz * y, const double * ydbl, slong yl,
+    slong bn, int mode, int squaring, slong prec)
+{
+    _block_pieces_t pw;
+    _block_acc_t aw;
+    slong i, num, xnum, ynum, threads;
+
+    num = 0;
+    pw.buf = NULL;
+    pw.off = NULL;
+    pw.len = NULL;
+
+    if (mode != ACC_RAD_DOUBLE)
+    {
+        /* split into xnum * ynum pieces, with xnum / ynum close to xl / yl
+           to keep the total length of the piece products small */
+        threads = flint_get_num_threads();
+        xnum = sqrt((double) threads * xl / yl) + 0.5;
+        xnum = FLINT_MAX(xnum, 1);
+        xnum = FLINT_MIN(xnum, threads);
+        xnum = FLINT_MIN(xnum, (xl + THREADED_PIECE_MIN_LENGTH - 1) / THREADED_PIECE_MIN_LENGTH);
+        ynum = FLINT_MAX(threads / xnum, 1);
+        ynum = FLINT_MIN(ynum, (yl + THREADED_PIECE_MIN_LENGTH - 1) / THREADED_PIECE_MIN_LENGTH);
+
+        /* the same splitting for both factors keeps the squares on
+           the diagonal */
+        if (squaring)
+            xnum = ynum = FLINT_MIN(xnum, ynum);
+
+        num = xnum * ynum;
+
+        pw.x = x;
+        pw.y = y;
+        pw.xl = xl;
+        pw.yl = yl;
+        pw.n = bn;
+        pw.xstep = (xl + xnum - 1) / xnum;
+        pw.ystep = (yl + ynum - 1) / ynum;
+        pw.ynum = ynum;
+        pw.squaring = squaring;
+        pw.buf = flint_malloc(sizeof(fmpz *) * num);
+        pw.off = flint_malloc(sizeof(slong) * num);
+        pw.len = flint_malloc(sizeof(slong) * num);
+
+        flint_parallel_do((do_func_t) _block_pieces_worker, &pw, num, -1,
+            FLINT_PARALLEL_DYNAMIC);
+    }
+
+    aw.z = z;
+    aw.zz = zz;
+    aw.zexp = zexp;
+    aw.buf = pw.buf;
+    aw.off = pw.off;
+    aw.len = pw.len;
+    aw.num = num;
+    aw.xdbl = xdbl;
+    aw.ydbl = ydbl;
+    aw.xl = xl;
+    aw.yl = yl;
+    aw.bn = bn;
+    aw.mode = mode;
+    aw.prec = prec;
+
+    flint_parallel_do((do_func_t) _block_acc_worker, &aw,
+        (bn + THREADED_ACC_CHUNK - 1) / THREADED_ACC_CHUNK, -1,
+        FLINT_PARALLEL_UNIFORM);
+
+    for (i = 0; i < num; i++)
+        if (pw.len[i] != 0)
+            _fmpz_vec_clear(pw.buf[i], pw.len[i]);
+
+    flint_free(pw.buf);
+    flint_free(pw.off);
+    flint_free(pw.len);
+}
+
+static int
+_block_use_threads(slong xl, slong yl)
+{
+    return FLINT_MIN(xl, yl) >= THREADED_BLOCK_MIN_LENGTH &&
+        flint_get_num_threads() > 1;
+}
+
 
 static void
 _mag_vec_get_fmpz_2exp_blocks(fmpz * coeffs,
@@ -357,6 +602,14 @@ _arb_poly_addmullow_rad(arb_ptr z, fmpz * zz,
             {
                 fmpz_add_ui(zexp, zexp, 2 * DOUBLE_BLOCK_SHIFT);
 
+                if (_block_use_threads(xl, yl))
+                {
+                    _arb_poly_addmullow_block_threaded(z + xp + yp, zz, zexp,
+                        NULL, xdbl + xp, xl, NULL, ydbl + yp, yl,
+                        bn, ACC_RAD_DOUBLE, 0, 0);
+                    continue;
+                }
+
                 for (k = 0; k < bn; k++)
                 {
                     /* Classical multiplication (may round down!) */
@@ -376,6 +629,12 @@ _arb_poly_addmullow_rad(arb_ptr z, fmpz * zz,
                             arb_radref(z + xp + yp + k), t);
                 }
             }
+            else if (_block_use_threads(xl, yl))
+            {
+                _arb_poly_addmullow_block_threaded(z + xp + yp, zz, zexp,
+                    xz + xp, NULL, xl, yz + yp, NULL, yl,
+                    bn, ACC_RAD, 0, 0);
+            }
             else
             {
                 if (xl >= yl)
@@ -419,9 +678,18 @@ _arb_poly_addmullow_block(arb_ptr z, fmpz * zz,
             bn = FLINT_MIN(2 * xl - 1, n - 2 * xp);
             xl = FLINT_MIN(xl, bn);
 
-            _fmpz_poly_sqrlow(zz, xz + xp, xl, bn);
             _fmpz_add2_fast(zexp, xexps + i, xexps + i, 0);
 
+            if (_block_use_threads(xl, xl))
+            {
+                _arb_poly_addmullow_block_threaded(z + 2 * xp, zz, zexp,
+                    xz + xp, NULL, xl, xz + xp, NULL, xl,
+                    bn, ACC_MID, 1, prec);
+                continue;
+            }
+
+            _fmpz_poly_sqrlow(zz, xz + xp, xl, bn);
+
             for (k = 0; k < bn; k++)
                 arb_add_fmpz_2exp(z + 2 * xp + k, z + 2 * xp + k, zz + k, zexp, prec);
         }
@@ -440,13 +708,21 @@ _arb_poly_addmullow_block(arb_ptr z, fmpz * zz,
             xl = FLINT_MIN(xl, bn);
             yl = FLINT_MIN(yl, bn);
 
+           _fmpz_add2_fast(zexp, xexps + i, yexps + j, squaring);
+
+            if (_block_use_threads(xl, yl))
+            {
+                _arb_poly_addmullow_block_threaded(z + xp + yp, zz, zexp,
+                    xz + xp, NULL, xl, yz + yp, NULL, yl,
+                    bn, ACC_MID, 0, prec);
+                continue;
+            }
+
             if (xl >= yl)
                 _fmpz_poly_mullow(zz, xz + xp, xl, yz + yp, yl, bn);
             else
                 _fmpz_poly_mullow(zz, yz + yp, yl, xz + xp, xl, bn);
 
-           _fmpz_add2_fast(zexp, xexps + i, yexps + j, squaring);
-
             for (k = 0; k < bn; k++)
                 arb_add_fmpz_2exp(z + xp + yp + k, z + xp + yp + k, zz + k, zexp, prec);
         }
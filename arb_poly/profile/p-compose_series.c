@@ -0,0 +1,115 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "arb_poly.h"
+#include "flint/profiler.h"
+
+/* Compares the algorithms for power series composition and reversion.
+   Horner's rule is skipped above HORNER_MAX and the other algorithms
+   with superlinear complexity above QUADRATIC_MAX.
+   The smallest accuracy (in bits) among the output coefficients
+   is printed next to each timing. */
+
+#define NUM_LEN 7
+#define HORNER_MAX 1000
+#define QUADRATIC_MAX 10000
+
+typedef void (*compose_f)(arb_ptr, arb_srcptr, slong, arb_srcptr, slong, slong, slong);
+typedef void (*revert_f)(arb_ptr, arb_srcptr, slong, slong, slong);
+
+static slong
+_min_accuracy(arb_srcptr x, slong len)
+{
+    slong i, acc = ARF_PREC_EXACT;
+
+    for (i = 0; i < len; i++)
+        acc = FLINT_MIN(acc, arb_rel_accuracy_bits(x + i));
+
+    return acc;
+}
+
+int main(int argc, char * argv[])
+{
+    slong len_tab[NUM_LEN] = { 100, 300, 1000, 3000, 10000, 30000, 100000 };
+    compose_f compose[3] = { _arb_poly_compose_series_horner,
+        _arb_poly_compose_series_brent_kung, _arb_poly_compose_series_kinoshita_li };
+    char * compose_name[3] = { "horner", "brent_kung", "kinoshita_li" };
+    revert_f revert[2] = { _arb_poly_revert_series_lagrange_fast,
+        _arb_poly_revert_series_newton };
+    char * revert_name[2] = { "lagrange_fast", "newton" };
+    arb_ptr f, g, h;
+    flint_rand_t state;
+    timeit_t timer;
+    slong i, j, n, prec;
+
+    prec = (argc > 1) ? atol(argv[1]) : 128;
+
+    flint_randinit(state);
+
+    flint_printf("prec = %wd\n\n", prec);
+
+    for (i = 0; i < NUM_LEN; i++)
+    {
+        n = len_tab[i];
+
+        f = _arb_vec_init(n);
+        g = _arb_vec_init(n);
+        h = _arb_vec_init(n);
+
+        /* g = x + (small terms), so that f(g) and the reversion of g
+           have well-scaled coefficients */
+        for (j = 0; j < n; j++)
+        {
+            arb_urandom(f + j, state, prec);
+            arb_urandom(g + j, state, prec);
+            arb_mul_2exp_si(g + j, g + j, -2);
+        }
+        arb_zero(g);
+        arb_one(g + 1);
+
+        for (j = 0; j < 3; j++)
+        {
+            if ((j == 0 && n > HORNER_MAX) || (j == 1 && n > QUADRATIC_MAX))
+                continue;
+
+            timeit_start(timer);
+            compose[j](h, f, n, g, n, n, prec);
+            timeit_stop(timer);
+
+            flint_printf("compose  n = %6wd  %-14s %10.3f s   acc = %wd\n",
+                n, compose_name[j], 0.001 * timer->wall, _min_accuracy(h, n));
+        }
+
+        for (j = 0; j < 2; j++)
+        {
+            if (j == 0 && n > QUADRATIC_MAX)
+                continue;
+
+            timeit_start(timer);
+            revert[j](h, g, n, n, prec);
+            timeit_stop(timer);
+
+            flint_printf("revert   n = %6wd  %-14s %10.3f s   acc = %wd\n",
+                n, revert_name[j], 0.001 * timer->wall, _min_accuracy(h + 1, n - 1));
+        }
+
+        flint_printf("\n");
+
+        _arb_vec_clear(f, n);
+        _arb_vec_clear(g, n);
+        _arb_vec_clear(h, n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    return 0;
+}
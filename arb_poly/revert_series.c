@@ -11,11 +11,18 @@
 
 #include "arb_poly.h"
 
+/* from this length, use Newton iteration, whose compositions of length
+   at least KINOSHITA_LI_CUTOFF_N in compose_series.c use Kinoshita-Li */
+#define REVERT_NEWTON_CUTOFF 2000
+
 void
 _arb_poly_revert_series(arb_ptr Qinv,
     arb_srcptr Q, slong Qlen, slong n, slong prec)
 {
-    _arb_poly_revert_series_lagrange_fast(Qinv, Q, Qlen, n, prec);
+    if (n < REVERT_NEWTON_CUTOFF)
+        _arb_poly_revert_series_lagrange_fast(Qinv, Q, Qlen, n, prec);
+    else
+        _arb_poly_revert_series_newton(Qinv, Q, Qlen, n, prec);
 }
 
 void
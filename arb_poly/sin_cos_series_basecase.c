@@ -17,6 +17,7 @@ _arb_poly_sin_cos_series_basecase(arb_ptr s, arb_ptr c, arb_srcptr h, slong hlen
 {
     slong k, alen = FLINT_MIN(n, hlen);
     arb_ptr a;
+    arb_arena_struct * arena;
     arb_t t, u;
 
     if (times_pi)
@@ -33,7 +34,9 @@ _arb_poly_sin_cos_series_basecase(arb_ptr s, arb_ptr c, arb_srcptr h, slong hlen
 
     arb_init(t);
     arb_init(u);
-    a = _arb_vec_init(alen);
+    arena = _arb_arena_thread();
+    arb_arena_push(arena);
+    a = _arb_arena_vec_init(arena, alen);
 
     for (k = 1; k < alen; k++)
         arb_mul_ui(a + k, h + k, k, prec);
@@ -54,7 +57,7 @@ _arb_poly_sin_cos_series_basecase(arb_ptr s, arb_ptr c, arb_srcptr h, slong hlen
 
     arb_clear(t);
     arb_clear(u);
-    _arb_vec_clear(a, alen);
+    arb_arena_pop(arena);
 }
 
 void
@@ -201,6 +201,49 @@ int main()
         arb_poly_clear(abc2);
     }
 
+    /* threaded block products give identical results */
+    for (iter = 0; iter < 20 * arb_test_multiplier(); iter++)
+    {
+        slong len1, len2, trunc, prec;
+        arb_poly_t a, b, c, d;
+        arb_poly_struct * y;
+
+        len1 = 200 + n_randint(state, 1000);
+        len2 = 200 + n_randint(state, 1000);
+        trunc = n_randint(state, len1 + len2);
+        prec = 2 + n_randint(state, 500);
+
+        arb_poly_init(a);
+        arb_poly_init(b);
+        arb_poly_init(c);
+        arb_poly_init(d);
+
+        arb_poly_randtest(a, state, len1, prec, 1 + n_randint(state, 20));
+
+        /* squaring */
+        arb_poly_randtest(b, state, len2, prec, 1 + n_randint(state, 20));
+        y = n_randint(state, 2) ? a : b;
+
+        flint_set_num_threads(1);
+        arb_poly_mullow_block(c, a, y, trunc, prec);
+        flint_set_num_threads(2 + n_randint(state, 7));
+        arb_poly_mullow_block(d, a, y, trunc, prec);
+        flint_set_num_threads(1);
+
+        if (!arb_poly_equal(c, d))
+        {
+            flint_printf("FAIL (threads)\n\n");
+            flint_printf("len1 = %wd, len2 = %wd, trunc = %wd, prec = %wd\n\n",
+                len1, len2, trunc, prec);
+            flint_abort();
+        }
+
+        arb_poly_clear(a);
+        arb_poly_clear(b);
+        arb_poly_clear(c);
+        arb_poly_clear(d);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
@@ -0,0 +1,145 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("tree....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        slong i, n, qbits1, qbits2, rbits1, rbits2, rbits3;
+        fmpq_poly_t P, Q;
+        arb_poly_t R, S;
+        arb_poly_tree_t T;
+        fmpq_t t, u;
+        fmpq * xq;
+        arb_ptr xs, ys, zs;
+
+        fmpq_poly_init(P);
+        fmpq_poly_init(Q);
+        arb_poly_init(R);
+        arb_poly_init(S);
+        fmpq_init(t);
+        fmpq_init(u);
+
+        qbits1 = 2 + n_randint(state, 100);
+        qbits2 = 2 + n_randint(state, 5);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+        rbits3 = 2 + n_randint(state, 200);
+
+        n = n_randint(state, (iter % 10 == 0) ? 150 : 20);
+
+        xq = _fmpq_vec_init(n);
+        xs = _arb_vec_init(n);
+        ys = _arb_vec_init(n);
+        zs = _arb_vec_init(n);
+
+        /* distinct points */
+        if (n > 0)
+        {
+            fmpq_randtest(xq, state, qbits2);
+
+            for (i = 1; i < n; i++)
+            {
+                fmpq_randtest_not_zero(u, state, qbits2);
+                fmpq_abs(u, u);
+                fmpq_add(xq + i, xq + i - 1, u);
+            }
+        }
+
+        for (i = 0; i < n; i++)
+            arb_set_fmpq(xs + i, xq + i, rbits1);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arb_poly_tree_init(T, xs, n, rbits1);
+
+        /* multipoint evaluation, for polynomials shorter and longer
+           than the number of points */
+        fmpq_poly_randtest(P, state, 1 + n_randint(state, 2 * n + 10), qbits1);
+        arb_poly_set_fmpq_poly(R, P, rbits2);
+        arb_poly_tree_evaluate_vec(ys, R, T, rbits2);
+
+        for (i = 0; i < n; i++)
+        {
+            fmpq_poly_evaluate_fmpq(t, P, xq + i);
+
+            if (!arb_contains_fmpq(ys + i, t))
+            {
+                flint_printf("FAIL (evaluate)\n\n");
+                flint_printf("n = %wd, i = %wd\n\n", n, i);
+                flint_printf("P = "); fmpq_poly_print(P); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(ys + i, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* the same result with one thread and without the object */
+        flint_set_num_threads(1);
+        arb_poly_evaluate_vec_fast(zs, R, xs, n, rbits2);
+
+        for (i = 0; i < n; i++)
+        {
+            if (!arb_overlaps(ys + i, zs + i))
+            {
+                flint_printf("FAIL (overlap)\n\n");
+                flint_abort();
+            }
+        }
+
+        /* interpolation */
+        fmpq_poly_randtest(Q, state, n, qbits1);
+
+        for (i = 0; i < n; i++)
+        {
+            fmpq_poly_evaluate_fmpq(t, Q, xq + i);
+            arb_set_fmpq(ys + i, t, rbits2);
+        }
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arb_poly_tree_interpolate(S, ys, T, rbits3);
+        flint_set_num_threads(1);
+
+        if (!arb_poly_contains_fmpq_poly(S, Q))
+        {
+            flint_printf("FAIL (interpolate)\n\n");
+            flint_printf("Q = "); fmpq_poly_print(Q); flint_printf("\n\n");
+            flint_printf("S = "); arb_poly_printd(S, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        arb_poly_tree_clear(T);
+
+        fmpq_poly_clear(P);
+        fmpq_poly_clear(Q);
+        arb_poly_clear(R);
+        arb_poly_clear(S);
+        fmpq_clear(t);
+        fmpq_clear(u);
+        _fmpq_vec_clear(xq, n);
+        _arb_vec_clear(xs, n);
+        _arb_vec_clear(ys, n);
+        _arb_vec_clear(zs, n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
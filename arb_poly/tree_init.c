@@ -0,0 +1,123 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "arb_poly.h"
+
+typedef struct
+{
+    arb_ptr inv;
+    arb_srcptr tree;
+    slong pow;
+    slong len;
+    slong prec;
+}
+_tree_inv_work_t;
+
+/* inverse of the reversal of node k, to the length pow of the
+   quotients which occur at this level */
+static void
+_tree_inv_worker(slong k, _tree_inv_work_t * w)
+{
+    slong pow = w->pow, d;
+    arb_ptr rev;
+
+    d = FLINT_MIN(pow, w->len - k * pow);
+    rev = _arb_vec_init(d + 1);
+
+    _arb_poly_reverse(rev, w->tree + k * (pow + 1), d + 1, d + 1);
+    _arb_poly_inv_series(w->inv + k * pow, rev, d + 1, pow, w->prec);
+
+    _arb_vec_clear(rev, d + 1);
+}
+
+arb_ptr *
+_arb_poly_tree_inverses_alloc(slong len)
+{
+    arb_ptr * inv = NULL;
+
+    if (len)
+    {
+        slong i, height = FLINT_CLOG2(len);
+
+        inv = flint_malloc(sizeof(arb_ptr) * (height + 1));
+        inv[0] = NULL;
+        for (i = 1; i < height; i++)
+            inv[i] = _arb_vec_init(len + (WORD(1) << i));
+    }
+
+    return inv;
+}
+
+void
+_arb_poly_tree_inverses_free(arb_ptr * inv, slong len)
+{
+    if (len)
+    {
+        slong i, height = FLINT_CLOG2(len);
+
+        for (i = 1; i < height; i++)
+            _arb_vec_clear(inv[i], len + (WORD(1) << i));
+
+        flint_free(inv);
+    }
+}
+
+void
+_arb_poly_tree_inverses(arb_ptr * inv, arb_ptr * tree, slong len, slong prec)
+{
+    _tree_inv_work_t work;
+    slong i, k, num;
+
+    /* the nodes of the built levels 1, ..., height - 1 */
+    for (i = 1; i < FLINT_CLOG2(len); i++)
+    {
+        work.inv = inv[i];
+        work.tree = tree[i];
+        work.pow = WORD(1) << i;
+        work.len = len;
+        work.prec = prec;
+
+        num = (len + work.pow - 1) / work.pow;
+
+        if (len >= 64 && flint_get_num_threads() > 1)
+        {
+            flint_parallel_do((do_func_t) _tree_inv_worker, &work, num, -1,
+                FLINT_PARALLEL_DYNAMIC);
+        }
+        else
+        {
+            for (k = 0; k < num; k++)
+                _tree_inv_worker(k, &work);
+        }
+    }
+}
+
+void
+arb_poly_tree_init(arb_poly_tree_t T, arb_srcptr xs, slong len, slong prec)
+{
+    T->len = len;
+    T->tree = _arb_poly_tree_alloc(len);
+    T->inv = _arb_poly_tree_inverses_alloc(len);
+    T->weights = _arb_vec_init(len);
+
+    _arb_poly_tree_build(T->tree, xs, len, prec);
+    _arb_poly_tree_inverses(T->inv, T->tree, len, prec);
+    _arb_poly_interpolation_weights(T->weights, T->tree, len, prec);
+}
+
+void
+arb_poly_tree_clear(arb_poly_tree_t T)
+{
+    _arb_poly_tree_free(T->tree, T->len);
+    _arb_poly_tree_inverses_free(T->inv, T->len);
+    _arb_vec_clear(T->weights, T->len);
+}
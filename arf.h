@@ -173,6 +173,36 @@ void _arf_promote(arf_t x, mp_size_t n);
 
 void _arf_demote(arf_t x);
 
+/* Thread-local cache for mantissa limbs */
+
+#define ARF_MAX_CACHE_LIMBS 64
+#define ARF_CACHE_DEFAULT_MAX_LIMBS (WORD(1) << 16)
+
+typedef struct
+{
+    ulong hits;
+    ulong misses;
+    ulong releases;
+    ulong frees;
+    slong cached_limbs;
+    slong cached_blocks;
+}
+arf_cache_stats_struct;
+
+typedef arf_cache_stats_struct arf_cache_stats_t[1];
+
+void arf_cache_set_enabled(int enabled);
+
+int arf_cache_enabled(void);
+
+void arf_cache_set_max_limbs(slong limbs);
+
+void arf_cache_get_stats(arf_cache_stats_t stats);
+
+void arf_cache_reset_stats(void);
+
+void arf_cache_clear(void);
+
 
 /* Warning: does not set size! -- also doesn't demote exponent. */
 #define ARF_DEMOTE(x)                 \
@@ -9,52 +9,154 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "pthread.h"
 #include "arf.h"
 
-#define ARF_USE_CACHE 0
+/*
+Thread-local cache of limb arrays for arf mantissas.
+
+Freed blocks of 2^b limbs, 2^b <= ARF_MAX_CACHE_LIMBS, are kept in
+singly linked lists, one per size class b. A promotion to n limbs
+takes a block from class ceil(log2(n)), or allocates a fresh block of
+that size so that the block later returns to the same class. Blocks
+of other sizes (resulting from reallocation) are simply freed.
+The first limb of a cached block stores its allocation and the
+second limb stores the pointer to the next block in the list.
+
+Each thread retains at most arf_cache_max_limbs limbs; beyond this,
+freed blocks go straight back to flint_free. The memory held by a thread
+is released when the thread exits (via a pthread key destructor)
+or when flint_cleanup() is called from that thread.
+*/
+
+#ifndef ARF_USE_CACHE
+#define ARF_USE_CACHE 1
+#endif
+
+#define ARF_CACHE_BINS 7
 
-#define ARF_MAX_CACHE_LIMBS 64
+static volatile int arf_cache_enabled_flag = 1;
+static volatile slong arf_cache_max_limbs = ARF_CACHE_DEFAULT_MAX_LIMBS;
 
-FLINT_TLS_PREFIX mp_ptr * arf_free_arr = NULL;
-FLINT_TLS_PREFIX ulong arf_free_num = 0;
-FLINT_TLS_PREFIX ulong arf_free_alloc = 0;
-FLINT_TLS_PREFIX int arf_have_registered_cleanup = 0;
+FLINT_TLS_PREFIX mp_ptr arf_cache_bin[ARF_CACHE_BINS];
+FLINT_TLS_PREFIX arf_cache_stats_struct arf_cache_stats;
+FLINT_TLS_PREFIX int arf_cache_thread_registered = 0;
+
+static pthread_once_t arf_cache_once = PTHREAD_ONCE_INIT;
+static pthread_key_t arf_cache_key;
+
+#define ARF_CACHE_NEXT(ptr) (*((mp_ptr *) ((ptr) + 1)))
 
 void _arf_cleanup(void)
 {
-    slong i;
-    for (i = 0; i < arf_free_num; i++)
-        flint_free(arf_free_arr[i]);
+    mp_ptr ptr, next;
+    slong b;
+
+    for (b = 0; b < ARF_CACHE_BINS; b++)
+    {
+        for (ptr = arf_cache_bin[b]; ptr != NULL; ptr = next)
+        {
+            next = ARF_CACHE_NEXT(ptr);
+            flint_free(ptr);
+        }
+
+        arf_cache_bin[b] = NULL;
+    }
+
+    arf_cache_stats.cached_limbs = 0;
+    arf_cache_stats.cached_blocks = 0;
+}
+
+static void
+_arf_cache_thread_exit(void * unused)
+{
+    _arf_cleanup();
+    /* Blocks released by later destructors register again. */
+    arf_cache_thread_registered = 0;
+}
 
-    flint_free(arf_free_arr);
+static void
+_arf_cache_init_once(void)
+{
+    pthread_key_create(&arf_cache_key, _arf_cache_thread_exit);
+    flint_register_cleanup_function(_arf_cleanup);
+}
 
-    arf_free_arr = NULL;
-    arf_free_num = 0;
-    arf_free_alloc = 0;
+static void
+_arf_cache_register_thread(void)
+{
+    pthread_once(&arf_cache_once, _arf_cache_init_once);
+    /* Any non-NULL value makes the destructor run on thread exit. */
+    pthread_setspecific(arf_cache_key, &arf_cache_once);
+    arf_cache_thread_registered = 1;
+}
+
+void
+arf_cache_set_enabled(int enabled)
+{
+    arf_cache_enabled_flag = (ARF_USE_CACHE && enabled);
+}
+
+int
+arf_cache_enabled(void)
+{
+    return ARF_USE_CACHE && arf_cache_enabled_flag;
+}
+
+void
+arf_cache_set_max_limbs(slong limbs)
+{
+    arf_cache_max_limbs = FLINT_MAX(limbs, 0);
+}
+
+void
+arf_cache_get_stats(arf_cache_stats_t stats)
+{
+    *stats = arf_cache_stats;
+}
+
+void
+arf_cache_reset_stats(void)
+{
+    arf_cache_stats.hits = 0;
+    arf_cache_stats.misses = 0;
+    arf_cache_stats.releases = 0;
+    arf_cache_stats.frees = 0;
+}
+
+void
+arf_cache_clear(void)
+{
+    _arf_cleanup();
 }
 
 void
 _arf_promote(arf_t x, mp_size_t n)
 {
-    if (ARF_USE_CACHE && n <= ARF_MAX_CACHE_LIMBS && arf_free_num != 0)
+    if (ARF_USE_CACHE && n <= ARF_MAX_CACHE_LIMBS && arf_cache_enabled_flag)
     {
         mp_ptr ptr;
-        mp_size_t alloc;
+        slong b;
 
-        ptr = arf_free_arr[--arf_free_num];
-        alloc = ptr[0];
+        b = FLINT_BIT_COUNT(n - 1);
+        ptr = arf_cache_bin[b];
 
-        if (alloc >= n)
+        if (ptr != NULL)
         {
+            arf_cache_bin[b] = ARF_CACHE_NEXT(ptr);
             ARF_PTR_ALLOC(x) = ptr[0];
-            ARF_PTR_D(x) = ptr;
+            arf_cache_stats.cached_limbs -= ptr[0];
+            arf_cache_stats.cached_blocks--;
+            arf_cache_stats.hits++;
         }
         else
         {
-            ptr = flint_realloc(ptr, n * sizeof(mp_limb_t));
-            ARF_PTR_ALLOC(x) = n;
-            ARF_PTR_D(x) = ptr;
+            ptr = flint_malloc((WORD(1) << b) * sizeof(mp_limb_t));
+            ARF_PTR_ALLOC(x) = WORD(1) << b;
+            arf_cache_stats.misses++;
         }
+
+        ARF_PTR_D(x) = ptr;
     }
     else
     {
@@ -72,27 +174,30 @@ _arf_demote(arf_t x)
     alloc = ARF_PTR_ALLOC(x);
     ptr = ARF_PTR_D(x);
 
-    if (ARF_USE_CACHE && alloc <= ARF_MAX_CACHE_LIMBS)
+    if (ARF_USE_CACHE && alloc <= ARF_MAX_CACHE_LIMBS && arf_cache_enabled_flag
+        && alloc > ARF_NOPTR_LIMBS && (alloc & (alloc - 1)) == 0
+        && arf_cache_stats.cached_limbs + alloc <= arf_cache_max_limbs)
     {
-        if (arf_free_num == arf_free_alloc)
-        {
-            if (!arf_have_registered_cleanup)
-            {
-                flint_register_cleanup_function(_arf_cleanup);
-                arf_have_registered_cleanup = 1;
-            }
-
-            arf_free_alloc = FLINT_MAX(64, arf_free_alloc * 2);
-            arf_free_arr = flint_realloc(arf_free_arr,
-                arf_free_alloc * sizeof(mp_ptr));
-        }
+        slong b;
+
+        if (!arf_cache_thread_registered)
+            _arf_cache_register_thread();
+
+        b = FLINT_BIT_COUNT(alloc) - 1;
 
         ptr[0] = alloc;
-        arf_free_arr[arf_free_num++] = ptr;
+        ARF_CACHE_NEXT(ptr) = arf_cache_bin[b];
+        arf_cache_bin[b] = ptr;
+
+        arf_cache_stats.cached_limbs += alloc;
+        arf_cache_stats.cached_blocks++;
+        arf_cache_stats.releases++;
     }
     else
     {
         flint_free(ptr);
+
+        if (ARF_USE_CACHE)
+            arf_cache_stats.frees++;
     }
 }
-
@@ -0,0 +1,126 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+#include "flint/profiler.h"
+
+#define LEN 100
+
+/* Temporaries are created and destroyed in the inner loop, as typically
+   happens in library code, so that limb arrays are promoted and demoted
+   on every iteration. */
+static void
+bench_mul(arb_srcptr x, arb_srcptr y, slong prec)
+{
+    arb_t t;
+    slong i;
+
+    for (i = 0; i < LEN; i++)
+    {
+        arb_init(t);
+        arb_mul(t, x + i, y + i, prec);
+        arb_clear(t);
+    }
+}
+
+static void
+bench_add(arb_srcptr x, arb_srcptr y, slong prec)
+{
+    arb_t t;
+    slong i;
+
+    for (i = 0; i < LEN; i++)
+    {
+        arb_init(t);
+        arb_add(t, x + i, y + i, prec);
+        arb_mul_2exp_si(t, t, 1);
+        arb_clear(t);
+    }
+}
+
+static void
+bench_dot(arb_srcptr x, arb_srcptr y, slong prec)
+{
+    arb_ptr t;
+    slong i;
+
+    t = _arb_vec_init(4);
+
+    for (i = 0; i < 4; i++)
+        arb_dot(t + i, NULL, 0, x + i, 1, y, 1, LEN - 4, prec);
+
+    _arb_vec_clear(t, 4);
+}
+
+typedef void (*bench_f)(arb_srcptr, arb_srcptr, slong);
+
+int main(void)
+{
+    bench_f func[3] = { bench_mul, bench_add, bench_dot };
+    char * name[3] = { "arb_mul", "arb_add", "arb_dot" };
+    slong prec_tab[5] = { 128, 192, 256, 512, 2048 };
+    arb_ptr x, y;
+    flint_rand_t state;
+    arf_cache_stats_t stats;
+    timeit_t timer;
+    slong i, j, k, reps, prec;
+    int enabled;
+    double t[2];
+
+    flint_randinit(state);
+
+    x = _arb_vec_init(LEN);
+    y = _arb_vec_init(LEN);
+
+    for (j = 0; j < 5; j++)
+    {
+        prec = prec_tab[j];
+        reps = 2000000 / (LEN * (1 + prec / 64));
+
+        for (i = 0; i < LEN; i++)
+        {
+            arb_urandom(x + i, state, prec);
+            arb_urandom(y + i, state, prec);
+        }
+
+        for (k = 0; k < 3; k++)
+        {
+            for (enabled = 0; enabled <= 1; enabled++)
+            {
+                arf_cache_set_enabled(enabled);
+                arf_cache_clear();
+                arf_cache_reset_stats();
+
+                timeit_start(timer);
+                for (i = 0; i < reps; i++)
+                    func[k](x, y, prec);
+                timeit_stop(timer);
+
+                t[enabled] = (double) timer->wall;
+                arf_cache_get_stats(stats);
+            }
+
+            flint_printf("%s  prec = %5wd   no cache: %8.1f ms   cache: %8.1f ms   "
+                "speedup %.2f   (hits %wu, misses %wu)\n",
+                name[k], prec, t[0], t[1], t[0] / t[1],
+                stats->hits, stats->misses);
+        }
+    }
+
+    _arb_vec_clear(x, LEN);
+    _arb_vec_clear(y, LEN);
+
+    arf_cache_set_enabled(1);
+    flint_randclear(state);
+    flint_cleanup();
+    return 0;
+}
+
@@ -0,0 +1,254 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "arf.h"
+
+/* Counts the blocks obtained from flint_malloc and friends which are
+   not yet freed. */
+
+static pthread_mutex_t count_lock = PTHREAD_MUTEX_INITIALIZER;
+static slong count_blocks = 0;
+
+static void * count_malloc(size_t size)
+{
+    void * ptr = malloc(size);
+    pthread_mutex_lock(&count_lock);
+    count_blocks++;
+    pthread_mutex_unlock(&count_lock);
+    return ptr;
+}
+
+static void * count_calloc(size_t num, size_t size)
+{
+    void * ptr = calloc(num, size);
+    pthread_mutex_lock(&count_lock);
+    count_blocks++;
+    pthread_mutex_unlock(&count_lock);
+    return ptr;
+}
+
+static void * count_realloc(void * ptr, size_t size)
+{
+    if (ptr == NULL)
+    {
+        pthread_mutex_lock(&count_lock);
+        count_blocks++;
+        pthread_mutex_unlock(&count_lock);
+    }
+
+    return realloc(ptr, size);
+}
+
+static void count_free(void * ptr)
+{
+    if (ptr != NULL)
+    {
+        pthread_mutex_lock(&count_lock);
+        count_blocks--;
+        pthread_mutex_unlock(&count_lock);
+    }
+
+    free(ptr);
+}
+
+/* Sets x to 1 + 2^(1-n), which needs a mantissa of exactly n bits. */
+static void
+_arf_set_bits(arf_t x, slong n)
+{
+    arf_one(x);
+    arf_mul_2exp_si(x, x, 1 - n);
+    arf_add_ui(x, x, 1, ARF_PREC_EXACT, ARF_RND_DOWN);
+}
+
+static void *
+worker(void * arg)
+{
+    arf_cache_stats_struct * stats = arg;
+    arf_t x[10];
+    slong i;
+
+    for (i = 0; i < 10; i++)
+    {
+        arf_init(x[i]);
+        _arf_set_bits(x[i], (i + 1) * 5 * FLINT_BITS);
+    }
+
+    for (i = 0; i < 10; i++)
+        arf_clear(x[i]);
+
+    arf_cache_get_stats(stats);
+    return NULL;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("cache....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 10000 * arb_test_multiplier(); iter++)
+    {
+        arf_t x, y, z, w;
+        arf_cache_stats_t stats;
+        slong prec;
+        int enabled;
+
+        enabled = n_randint(state, 4) != 0;
+        arf_cache_set_enabled(enabled);
+
+        if (n_randint(state, 100) == 0)
+            arf_cache_set_max_limbs(n_randint(state, 200));
+        else if (n_randint(state, 100) == 0)
+            arf_cache_set_max_limbs(ARF_CACHE_DEFAULT_MAX_LIMBS);
+
+        if (n_randint(state, 100) == 0)
+            arf_cache_clear();
+
+        arf_init(x);
+        arf_init(y);
+        arf_init(z);
+        arf_init(w);
+
+        prec = 2 + n_randint(state, 5000);
+
+        arf_randtest(x, state, 2 + n_randint(state, 5000), 10);
+        arf_randtest(y, state, 2 + n_randint(state, 5000), 10);
+
+        arf_mul(z, x, y, prec, ARF_RND_DOWN);
+
+        arf_cache_set_enabled(!enabled);
+        arf_mul(w, x, y, prec, ARF_RND_DOWN);
+        arf_cache_set_enabled(enabled);
+
+        if (!arf_equal(z, w))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("x = "); arf_print(x); flint_printf("\n\n");
+            flint_printf("y = "); arf_print(y); flint_printf("\n\n");
+            flint_printf("z = "); arf_print(z); flint_printf("\n\n");
+            flint_printf("w = "); arf_print(w); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        arf_swap(z, x);
+        arf_add(z, z, w, prec, ARF_RND_NEAR);
+
+        arf_clear(x);
+        arf_clear(y);
+        arf_clear(z);
+        arf_clear(w);
+
+        arf_cache_get_stats(stats);
+
+        if (stats->cached_limbs < 0 || stats->cached_blocks < 0 ||
+            stats->cached_limbs < stats->cached_blocks * (ARF_NOPTR_LIMBS + 1) ||
+            stats->cached_limbs > stats->cached_blocks * ARF_MAX_CACHE_LIMBS)
+        {
+            flint_printf("FAIL (stats)\n\n");
+            flint_printf("cached_limbs = %wd, cached_blocks = %wd\n\n",
+                stats->cached_limbs, stats->cached_blocks);
+            flint_abort();
+        }
+    }
+
+    arf_cache_set_enabled(1);
+    arf_cache_set_max_limbs(ARF_CACHE_DEFAULT_MAX_LIMBS);
+    arf_cache_clear();
+
+    /* the cache retains at most ARF_CACHE_DEFAULT_MAX_LIMBS limbs */
+    if (arf_cache_enabled())
+    {
+        arf_ptr x;
+        arf_cache_stats_t stats;
+        slong i, len, cap;
+
+        cap = ARF_CACHE_DEFAULT_MAX_LIMBS / ARF_MAX_CACHE_LIMBS;
+        len = cap + 100;
+        x = _arf_vec_init(len);
+
+        for (i = 0; i < len; i++)
+        {
+            _arf_set_bits(x + i, ARF_MAX_CACHE_LIMBS * FLINT_BITS);
+
+            if (!ARF_HAS_PTR(x + i) ||
+                ARF_PTR_ALLOC(x + i) != ARF_MAX_CACHE_LIMBS)
+            {
+                flint_printf("FAIL (alloc)\n\n");
+                flint_abort();
+            }
+        }
+
+        arf_cache_reset_stats();
+        _arf_vec_clear(x, len);
+        arf_cache_get_stats(stats);
+
+        if (stats->cached_limbs != ARF_CACHE_DEFAULT_MAX_LIMBS ||
+            stats->cached_blocks != cap ||
+            stats->releases != cap || stats->frees != len - cap)
+        {
+            flint_printf("FAIL (cap)\n\n");
+            flint_printf("cached_limbs = %wd, cached_blocks = %wd\n",
+                stats->cached_limbs, stats->cached_blocks);
+            flint_printf("releases = %wu, frees = %wu\n\n",
+                stats->releases, stats->frees);
+            flint_abort();
+        }
+
+        arf_cache_clear();
+        arf_cache_get_stats(stats);
+
+        if (stats->cached_limbs != 0 || stats->cached_blocks != 0)
+        {
+            flint_printf("FAIL (clear)\n\n");
+            flint_abort();
+        }
+    }
+
+    /* the cache of a thread is freed when the thread exits */
+    for (iter = 0; iter < 10 * arb_test_multiplier(); iter++)
+    {
+        pthread_t thread;
+        arf_cache_stats_t stats;
+
+        __flint_set_memory_functions(count_malloc, count_calloc,
+            count_realloc, count_free);
+        count_blocks = 0;
+
+        if (pthread_create(&thread, NULL, worker, stats) != 0 ||
+            pthread_join(thread, NULL) != 0)
+        {
+            flint_printf("FAIL (pthread)\n\n");
+            flint_abort();
+        }
+
+        __flint_set_memory_functions(malloc, calloc, realloc, free);
+
+        if (stats->cached_blocks != (arf_cache_enabled() ? 10 : 0) ||
+            count_blocks != 0)
+        {
+            flint_printf("FAIL (thread exit)\n\n");
+            flint_printf("cached_blocks = %wd, count_blocks = %wd\n\n",
+                stats->cached_blocks, count_blocks);
+            flint_abort();
+        }
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -167,6 +167,8 @@ void dirichlet_chi_vec(ulong *v, const dirichlet_group_t G, const dirichlet_char
 void dirichlet_chi_vec_loop_order(ulong *v, const dirichlet_group_t G, const dirichlet_char_t chi, ulong order, slong nv);
 void dirichlet_chi_vec_primeloop_order(ulong *v, const dirichlet_group_t G, const dirichlet_char_t chi, ulong order, slong nv);
 void dirichlet_chi_vec_order(ulong *v, const dirichlet_group_t G, const dirichlet_char_t chi, ulong order, slong nv);
+void dirichlet_chi_vec_many(ulong * v, const dirichlet_group_t G, const dirichlet_char_struct * chi, slong num, slong nv);
+void dirichlet_chi_vec_many_order(ulong * v, const dirichlet_group_t G, const dirichlet_char_struct * chi, slong num, ulong order, slong nv);
 
 #ifdef __cplusplus
 }
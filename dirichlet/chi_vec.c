@@ -11,10 +11,15 @@
 
 #include "dirichlet.h"
 
+/* use the table based, multithreaded version from this length */
+#define CHI_VEC_THREADED_MIN_LEN 65536
+
 void
 dirichlet_chi_vec(ulong *v, const dirichlet_group_t G, const dirichlet_char_t chi, slong nv)
 {
-    if (2 * nv > G->phi_q)
+    if (nv >= CHI_VEC_THREADED_MIN_LEN && flint_get_num_threads() > 1)
+        dirichlet_chi_vec_many_order(v, G, chi, 1, G->expo, nv);
+    else if (2 * nv > G->phi_q)
         dirichlet_chi_vec_loop(v, G, chi, nv);
     else
         dirichlet_chi_vec_primeloop(v, G, chi, nv);
@@ -23,7 +28,9 @@ dirichlet_chi_vec(ulong *v, const dirichlet_group_t G, const dirichlet_char_t ch
 void
 dirichlet_chi_vec_order(ulong *v, const dirichlet_group_t G, const dirichlet_char_t chi, ulong order, slong nv)
 {
-    if (2 * nv > G->phi_q)
+    if (nv >= CHI_VEC_THREADED_MIN_LEN && flint_get_num_threads() > 1)
+        dirichlet_chi_vec_many_order(v, G, chi, 1, order, nv);
+    else if (2 * nv > G->phi_q)
         dirichlet_chi_vec_loop_order(v, G, chi, order, nv);
     else
         dirichlet_chi_vec_primeloop_order(v, G, chi, order, nv);
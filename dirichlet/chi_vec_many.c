@@ -0,0 +1,220 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "dirichlet.h"
+
+/*
+The discrete logarithms of 0 <= x < nv in each primary component are
+periodic modulo p^e, so they are computed once on [0, min(p^e, nv))
+(by the dlog_vec machinery for odd p, one task per component).
+The values of all characters are then obtained by scaling and adding
+these logarithms, working through [0, nv) in segments which are
+distributed over threads.
+*/
+
+#define CHI_VEC_SEGMENT 4096
+
+typedef struct
+{
+    ulong ** T;
+    slong * len;
+    const dirichlet_group_struct * G;
+}
+_chi_vec_logs_work_t;
+
+static void
+_chi_vec_logs_worker(slong l, _chi_vec_logs_work_t * work)
+{
+    const dirichlet_prime_group_struct * P = work->G->P + l;
+    ulong * T = work->T[l];
+    ulong n = work->len[l];
+    ulong x, k;
+
+    if (l < work->G->neven)
+    {
+        dlog_vec_fill(T, n, DLOG_NOT_FOUND);
+
+        if (l == 0)
+        {
+            /* component generated by -1 */
+            for (x = 1; x < n; x += 2)
+                T[x] = (x % 4 == 3);
+        }
+        else
+        {
+            /* x = +- 5^k mod 2^e */
+            x = 1;
+            k = 0;
+            do
+            {
+                if (x < n)
+                    T[x] = k;
+                if (P->pe.n - x < n)
+                    T[P->pe.n - x] = k;
+                x = nmod_mul(x, P->g, P->pe);
+                k++;
+            }
+            while (x != 1);
+        }
+    }
+    else if (P->dlog == NULL)
+    {
+        dlog_vec(T, n, P->g, 1, P->pe, P->phi.n, P->phi);
+    }
+    else
+    {
+        dlog_vec_sieve_precomp(T, n, P->dlog, P->g, 1, P->pe, P->phi.n, P->phi);
+    }
+}
+
+typedef struct
+{
+    ulong * v;
+    const ulong ** T;
+    const ulong * c;
+    const dirichlet_group_struct * G;
+    slong num;
+    slong nv;
+    nmod_t order;
+}
+_chi_vec_fill_work_t;
+
+static void
+_chi_vec_fill_worker(slong s, _chi_vec_fill_work_t * work)
+{
+    const dirichlet_group_struct * G = work->G;
+    slong x0, x1, i, j, l, n, ncomp;
+    ulong * L, r, t;
+    char * null;
+    nmod_t o = work->order;
+
+    ncomp = G->num;
+    x0 = s * CHI_VEC_SEGMENT;
+    x1 = FLINT_MIN(x0 + CHI_VEC_SEGMENT, work->nv);
+    n = x1 - x0;
+
+    L = flint_malloc(sizeof(ulong) * (ncomp * n + 1));
+    null = flint_malloc(n);
+
+    for (i = 0; i < n; i++)
+        null[i] = (G->q_even > 1 && (x0 + i) % 2 == 0) || (x0 + i == 0 && G->q > 1);
+
+    /* logarithms of the segment, reduced modulo the order */
+    for (l = 0; l < ncomp; l++)
+    {
+        ulong pe = G->P[l].pe.n;
+
+        r = x0 % pe;
+        for (i = 0; i < n; i++)
+        {
+            t = work->T[l][r];
+
+            if (t == DLOG_NOT_FOUND)
+                null[i] = 1;
+            else
+                NMOD_RED(L[l * n + i], t, o);
+
+            if (++r == pe)
+                r = 0;
+        }
+    }
+
+    for (j = 0; j < work->num; j++)
+    {
+        ulong * v = work->v + j * work->nv + x0;
+        const ulong * c = work->c + j * ncomp;
+
+        for (i = 0; i < n; i++)
+        {
+            if (null[i])
+            {
+                v[i] = DIRICHLET_CHI_NULL;
+            }
+            else
+            {
+                t = 0;
+                for (l = 0; l < ncomp; l++)
+                    if (c[l] != 0)
+                        t = nmod_add(t, nmod_mul(c[l], L[l * n + i], o), o);
+                v[i] = t;
+            }
+        }
+    }
+
+    flint_free(L);
+    flint_free(null);
+}
+
+void
+dirichlet_chi_vec_many_order(ulong * v, const dirichlet_group_t G,
+    const dirichlet_char_struct * chi, slong num, ulong order, slong nv)
+{
+    _chi_vec_logs_work_t lwork;
+    _chi_vec_fill_work_t fwork;
+    ulong ** T;
+    ulong * c;
+    slong * len;
+    slong j, l, nseg;
+    ulong mult;
+    nmod_t o;
+
+    if (num <= 0 || nv <= 0)
+        return;
+
+    T = flint_malloc(sizeof(ulong *) * (G->num + 1));
+    len = flint_malloc(sizeof(slong) * (G->num + 1));
+    c = flint_malloc(sizeof(ulong) * (num * G->num + 1));
+
+    for (l = 0; l < G->num; l++)
+    {
+        len[l] = FLINT_MIN(G->P[l].pe.n, (ulong) nv);
+        T[l] = flint_malloc(sizeof(ulong) * len[l]);
+    }
+
+    lwork.T = T;
+    lwork.len = len;
+    lwork.G = G;
+    flint_parallel_do((do_func_t) _chi_vec_logs_worker, &lwork, G->num, -1,
+        FLINT_PARALLEL_DYNAMIC);
+
+    /* chi(x) = sum_l log_l(chi) log_l(x) PHI[l] / mult */
+    mult = G->expo / order;
+    for (j = 0; j < num; j++)
+        for (l = 0; l < G->num; l++)
+            c[j * G->num + l] = (chi[j].log[l] * G->PHI[l]) / mult;
+
+    nmod_init(&o, order);
+    fwork.v = v;
+    fwork.T = (const ulong **) T;
+    fwork.c = c;
+    fwork.G = G;
+    fwork.num = num;
+    fwork.nv = nv;
+    fwork.order = o;
+
+    nseg = (nv + CHI_VEC_SEGMENT - 1) / CHI_VEC_SEGMENT;
+    flint_parallel_do((do_func_t) _chi_vec_fill_worker, &fwork, nseg, -1,
+        FLINT_PARALLEL_UNIFORM);
+
+    for (l = 0; l < G->num; l++)
+        flint_free(T[l]);
+    flint_free(T);
+    flint_free(len);
+    flint_free(c);
+}
+
+void
+dirichlet_chi_vec_many(ulong * v, const dirichlet_group_t G,
+    const dirichlet_char_struct * chi, slong num, slong nv)
+{
+    dirichlet_chi_vec_many_order(v, G, chi, num, G->expo, nv);
+}
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "dirichlet.h"
 
 void
@@ -19,15 +20,29 @@ dirichlet_prime_group_dlog_precompute(dirichlet_prime_group_struct * P, ulong nu
     dlog_precomp_modpe_init(P->dlog, P->g, P->p, P->e, P->pe.n, num);
 }
 
+typedef struct
+{
+    dirichlet_prime_group_struct * P;
+    ulong num;
+}
+_dlog_precompute_work_t;
+
+static void
+_dlog_precompute_worker(slong k, _dlog_precompute_work_t * work)
+{
+    if (work->P[k].dlog == NULL)
+        dirichlet_prime_group_dlog_precompute(work->P + k, work->num);
+}
+
+/* the components are independent, so they are done in parallel */
 void
 dirichlet_group_dlog_precompute(dirichlet_group_t G, ulong num)
 {
-    slong k;
-    for (k = 0; k < G->num; k++)
-    {
-        if (G->P[k].dlog == NULL)
-            dirichlet_prime_group_dlog_precompute(&G->P[k], num);
-    }
+    _dlog_precompute_work_t work;
+    work.P = G->P;
+    work.num = num;
+    flint_parallel_do((do_func_t) _dlog_precompute_worker, &work, G->num, -1,
+        FLINT_PARALLEL_DYNAMIC);
 }
 
 void
@@ -76,6 +76,53 @@ int main()
 
         } while (dirichlet_char_next(chi, G) >= 0);
 
+        /* all characters at once */
+        {
+            dirichlet_char_struct * chis;
+            ulong * w, nw, num, j;
+
+            num = G->phi_q;
+            nw = (q < 200) ? 3 * q + 1 : 100;
+            chis = flint_malloc(num * sizeof(dirichlet_char_struct));
+            w = flint_malloc(num * nw * sizeof(ulong));
+            v1 = flint_realloc(v1, nw * sizeof(ulong));
+
+            dirichlet_char_one(chi, G);
+            for (j = 0; j < num; j++)
+            {
+                dirichlet_char_init(chis + j, G);
+                dirichlet_char_set(chis + j, G, chi);
+                dirichlet_char_next(chi, G);
+            }
+
+            flint_set_num_threads(1 + q % 3);
+            if (q % 2)
+                dirichlet_group_dlog_precompute(G, 1);
+            dirichlet_chi_vec_many(w, G, chis, num, nw);
+            flint_set_num_threads(1);
+
+            for (j = 0; j < num; j++)
+            {
+                dirichlet_chi_vec_loop(v1, G, chis + j, nw);
+
+                if ((k = vec_diff(w + j * nw, v1, nw)))
+                {
+                    flint_printf("FAIL: chi_vec_many chi_%wu(%wu,%wu)\n", q, chis[j].n, k);
+                    flint_printf("vec_loop -> %wu\n", v1[k]);
+                    flint_printf("vec_many -> %wu\n", w[j * nw + k]);
+                    flint_abort();
+                }
+            }
+
+            if (q % 2)
+                dirichlet_group_dlog_clear(G);
+
+            for (j = 0; j < num; j++)
+                dirichlet_char_clear(chis + j);
+            flint_free(chis);
+            flint_free(w);
+        }
+
         flint_free(v1);
         flint_free(v2);
         dirichlet_group_clear(G);
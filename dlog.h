@@ -18,6 +18,7 @@
 #define DLOG_INLINE static __inline__
 #endif
 
+#include <stdio.h>
 #include "flint/flint.h"
 
 #ifndef flint_abort
@@ -164,6 +165,9 @@ void dlog_precomp_p_init(dlog_precomp_t pre, ulong a, ulong mod, ulong p, ulong
 void dlog_precomp_pe_init(dlog_precomp_t pre, ulong a, ulong mod, ulong p, ulong e, ulong pe, ulong num);
 void dlog_precomp_clear(dlog_precomp_t pre);
 
+int dlog_precomp_dump_file(FILE * stream, const dlog_precomp_t pre);
+int dlog_precomp_load_file(dlog_precomp_t pre, FILE * stream);
+
 ulong dlog_precomp(const dlog_precomp_t pre, ulong b);
 
 ulong dlog_order23_init(dlog_order23_t t, ulong a);
@@ -219,14 +223,9 @@ dlog_rho_clear(dlog_rho_t t)
     return;
 }
 
-DLOG_INLINE ulong
-dlog_bsgs_size(ulong n, ulong num)
-{
-    if (2 * num < n)
-        return (1 + n_sqrt(n)) * (1 + n_sqrt(num));
-    else
-        return n;
-}
+ulong dlog_bsgs_size(ulong n, ulong num);
+void dlog_bsgs_set_table_factor(ulong f);
+ulong dlog_bsgs_table_factor(void);
 
 /*#define dlog_bsgs_clear(t) bsgs_table_clear(t)*/
 
@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "dlog.h"
+
+static ulong _dlog_bsgs_table_factor = 1;
+
+void
+dlog_bsgs_set_table_factor(ulong f)
+{
+    _dlog_bsgs_table_factor = FLINT_MAX(f, 1);
+}
+
+ulong
+dlog_bsgs_table_factor(void)
+{
+    return _dlog_bsgs_table_factor;
+}
+
+/* a table of m baby steps leaves about n / m giant steps per logarithm;
+   the factor trades memory for fewer giant steps */
+ulong
+dlog_bsgs_size(ulong n, ulong num)
+{
+    ulong m;
+
+    if (2 * num >= n)
+        return n;
+
+    m = (1 + n_sqrt(n)) * (1 + n_sqrt(num));
+
+    if (_dlog_bsgs_table_factor > 1)
+    {
+        if (m >= n / _dlog_bsgs_table_factor)
+            return n;
+        m *= _dlog_bsgs_table_factor;
+    }
+
+    return FLINT_MIN(m, n);
+}
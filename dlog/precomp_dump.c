@@ -0,0 +1,301 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "dlog.h"
+
+/*
+The tree is written depth-first as raw machine words: each node starts
+with its type and cost, followed by the fields and tables of the
+corresponding structure and by its children. Moduli are stored as plain
+integers and the nmod_t structures are recomputed when loading.
+A file can only be read back on a machine with the same word size and
+byte order, which is checked using the header.
+*/
+
+#define DLOG_DUMP_VERSION 1
+
+static const char _dlog_dump_tag[8] = { 'd', 'l', 'o', 'g', 'p', 'r', 'e', '\n' };
+
+static int
+_write_ui(FILE * stream, const ulong * x, ulong n)
+{
+    return n != 0 && fwrite(x, sizeof(ulong), n, stream) != n;
+}
+
+static int
+_read_ui(ulong * x, ulong n, FILE * stream)
+{
+    return n != 0 && fread(x, sizeof(ulong), n, stream) != n;
+}
+
+static int
+_write_1(FILE * stream, ulong x)
+{
+    return _write_ui(stream, &x, 1);
+}
+
+static int
+_dlog_precomp_dump(FILE * stream, const dlog_precomp_t pre)
+{
+    ulong k;
+
+    if (_write_1(stream, pre->type) || _write_1(stream, pre->cost))
+        return 1;
+
+    switch (pre->type)
+    {
+        case DLOG_TABLE:
+            return _write_1(stream, pre->t.table->mod)
+                || _write_ui(stream, pre->t.table->table, pre->t.table->mod);
+
+        case DLOG_BSGS:
+        {
+            const dlog_bsgs_struct * t = pre->t.bsgs;
+
+            if (_write_1(stream, t->mod.n) || _write_1(stream, t->m) ||
+                _write_1(stream, t->am) || _write_1(stream, t->g))
+                return 1;
+
+            for (k = 0; k < t->m; k++)
+                if (_write_1(stream, t->table[k].k) || _write_1(stream, t->table[k].ak))
+                    return 1;
+
+            return 0;
+        }
+
+        case DLOG_CRT:
+        {
+            const dlog_crt_struct * t = pre->t.crt;
+
+            if (_write_1(stream, t->mod.n) || _write_1(stream, t->n.n) ||
+                _write_1(stream, t->num) || _write_ui(stream, t->expo, t->num) ||
+                _write_ui(stream, t->crt_coeffs, t->num))
+                return 1;
+
+            for (k = 0; k < t->num; k++)
+                if (_dlog_precomp_dump(stream, t->pre + k))
+                    return 1;
+
+            return 0;
+        }
+
+        case DLOG_POWER:
+        {
+            const dlog_power_struct * t = pre->t.power;
+
+            return _write_1(stream, t->mod.n) || _write_1(stream, t->p)
+                || _write_1(stream, t->e) || _write_ui(stream, t->apk, t->e)
+                || _dlog_precomp_dump(stream, t->pre);
+        }
+
+        case DLOG_MODPE:
+        {
+            const dlog_modpe_struct * t = pre->t.modpe;
+
+            return _write_1(stream, t->p) || _write_1(stream, t->e)
+                || _write_1(stream, t->pe1) || _write_1(stream, t->inva)
+                || _write_1(stream, t->pe.n) || _write_1(stream, t->modpe->inv1p)
+                || _write_1(stream, t->modpe->invloga1)
+                || _write_1(stream, t->modp != NULL)
+                || (t->modp != NULL && _dlog_precomp_dump(stream, t->modp));
+        }
+
+        case DLOG_23:
+            return _write_1(stream, pre->t.order23[0]);
+
+        default:
+            return 1;
+    }
+}
+
+/* on failure, nothing is left allocated in pre */
+static int
+_dlog_precomp_load(dlog_precomp_t pre, FILE * stream, int depth)
+{
+    ulong x[8], k;
+
+    /* the trees built by the init functions have depth at most 4 */
+    if (depth > 16 || _read_ui(x, 2, stream))
+        return 1;
+
+    pre->type = x[0];
+    pre->cost = x[1];
+
+    switch (pre->type)
+    {
+        case DLOG_TABLE:
+        {
+            dlog_table_struct * t = pre->t.table;
+
+            if (_read_ui(x, 1, stream) || x[0] == 0)
+                return 1;
+
+            t->mod = x[0];
+            t->table = flint_malloc(t->mod * sizeof(ulong));
+
+            if (_read_ui(t->table, t->mod, stream))
+            {
+                flint_free(t->table);
+                return 1;
+            }
+
+            return 0;
+        }
+
+        case DLOG_BSGS:
+        {
+            dlog_bsgs_struct * t = pre->t.bsgs;
+
+            if (_read_ui(x, 4, stream) || x[0] == 0 || x[1] == 0 || x[1] > x[0])
+                return 1;
+
+            nmod_init(&t->mod, x[0]);
+            t->m = x[1];
+            t->am = x[2];
+            t->g = x[3];
+            t->table = flint_malloc(t->m * sizeof(apow_t));
+
+            for (k = 0; k < t->m; k++)
+            {
+                if (_read_ui(x, 2, stream))
+                {
+                    flint_free(t->table);
+                    return 1;
+                }
+
+                t->table[k].k = x[0];
+                t->table[k].ak = x[1];
+            }
+
+            return 0;
+        }
+
+        case DLOG_CRT:
+        {
+            dlog_crt_struct * t = pre->t.crt;
+
+            if (_read_ui(x, 3, stream) || x[0] == 0 || x[1] == 0 || x[2] > FLINT_BITS)
+                return 1;
+
+            nmod_init(&t->mod, x[0]);
+            nmod_init(&t->n, x[1]);
+            t->num = x[2];
+            t->expo = flint_malloc((t->num + 1) * sizeof(ulong));
+            t->crt_coeffs = flint_malloc((t->num + 1) * sizeof(ulong));
+            t->pre = flint_malloc((t->num + 1) * sizeof(dlog_precomp_struct));
+
+            if (_read_ui(t->expo, t->num, stream) ||
+                _read_ui(t->crt_coeffs, t->num, stream))
+                k = 0;
+            else
+                for (k = 0; k < t->num; k++)
+                    if (_dlog_precomp_load(t->pre + k, stream, depth + 1))
+                        break;
+
+            if (k < t->num)
+            {
+                t->num = k;
+                dlog_crt_clear(t);
+                return 1;
+            }
+
+            return 0;
+        }
+
+        case DLOG_POWER:
+        {
+            dlog_power_struct * t = pre->t.power;
+
+            if (_read_ui(x, 3, stream) || x[0] == 0 || x[2] == 0 || x[2] > FLINT_BITS)
+                return 1;
+
+            nmod_init(&t->mod, x[0]);
+            t->p = x[1];
+            t->e = x[2];
+            t->apk = flint_malloc(t->e * sizeof(ulong));
+            t->pre = flint_malloc(sizeof(dlog_precomp_struct));
+
+            if (_read_ui(t->apk, t->e, stream) ||
+                _dlog_precomp_load(t->pre, stream, depth + 1))
+            {
+                flint_free(t->apk);
+                flint_free(t->pre);
+                return 1;
+            }
+
+            return 0;
+        }
+
+        case DLOG_MODPE:
+        {
+            dlog_modpe_struct * t = pre->t.modpe;
+
+            if (_read_ui(x, 8, stream) || x[4] == 0)
+                return 1;
+
+            t->p = x[0];
+            t->e = x[1];
+            t->pe1 = x[2];
+            t->inva = x[3];
+            nmod_init(&t->pe, x[4]);
+            t->modpe->inv1p = x[5];
+            t->modpe->invloga1 = x[6];
+            t->modp = NULL;
+
+            if (x[7])
+            {
+                t->modp = flint_malloc(sizeof(dlog_precomp_struct));
+
+                if (_dlog_precomp_load(t->modp, stream, depth + 1))
+                {
+                    flint_free(t->modp);
+                    return 1;
+                }
+            }
+
+            return 0;
+        }
+
+        case DLOG_23:
+            return _read_ui(pre->t.order23, 1, stream);
+
+        default:
+            return 1;
+    }
+}
+
+/* the header: tag, version, word size and a byte order mark */
+int
+dlog_precomp_dump_file(FILE * stream, const dlog_precomp_t pre)
+{
+    if (fwrite(_dlog_dump_tag, 1, 8, stream) != 8 ||
+        _write_1(stream, DLOG_DUMP_VERSION) ||
+        _write_1(stream, FLINT_BITS) || _write_1(stream, UWORD(0x01020304)))
+        return 1;
+
+    return _dlog_precomp_dump(stream, pre);
+}
+
+int
+dlog_precomp_load_file(dlog_precomp_t pre, FILE * stream)
+{
+    char tag[8];
+    ulong x[3];
+
+    if (fread(tag, 1, 8, stream) != 8 || memcmp(tag, _dlog_dump_tag, 8) != 0 ||
+        _read_ui(x, 3, stream) || x[0] != DLOG_DUMP_VERSION ||
+        x[1] != FLINT_BITS || x[2] != UWORD(0x01020304))
+        return 1;
+
+    return _dlog_precomp_load(pre, stream, 0);
+}
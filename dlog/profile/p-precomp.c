@@ -10,6 +10,7 @@
 */
 
 #include <math.h>
+#include <stdio.h>
 #include <string.h>
 #include "dlog.h"
 #include "flint/profiler.h"
@@ -87,6 +88,54 @@ flog_gen(ulong p, ulong a, ulong num)
     dlog_precomp_clear(t);
 }
 
+/* larger baby-step tables: fewer giant steps per logarithm */
+#define BIG_TABLE_FACTOR 8
+
+void
+flog_bsgs_big(ulong p, ulong a, ulong num)
+{
+    dlog_bsgs_set_table_factor(BIG_TABLE_FACTOR);
+    flog_bsgs(p, a, num);
+    dlog_bsgs_set_table_factor(1);
+}
+void
+flog_gen_big(ulong p, ulong a, ulong num)
+{
+    dlog_bsgs_set_table_factor(BIG_TABLE_FACTOR);
+    flog_gen(p, a, num);
+    dlog_bsgs_set_table_factor(1);
+}
+
+/* precomputation only, built from scratch or read back from a file */
+void
+finit_gen(ulong p, ulong a, ulong num)
+{
+    dlog_precomp_t t;
+    dlog_precomp_n_init(t, a, p, p-1, num);
+    dlog_precomp_clear(t);
+}
+void
+fload_gen(ulong p, ulong a, ulong num)
+{
+    dlog_precomp_t t;
+    FILE * tmp;
+
+    dlog_precomp_n_init(t, a, p, p-1, num);
+    tmp = tmpfile();
+    if (tmp == NULL || dlog_precomp_dump_file(tmp, t))
+        flint_abort();
+    dlog_precomp_clear(t);
+    rewind(tmp);
+
+    TIMEIT_ONCE_START
+        if (dlog_precomp_load_file(t, tmp))
+            flint_abort();
+    TIMEIT_ONCE_STOP
+
+    dlog_precomp_clear(t);
+    fclose(tmp);
+}
+
 int main(int argc, char *argv[])
 {
     int out = LOG;
@@ -96,9 +145,9 @@ int main(int argc, char *argv[])
     int nbits, nl = 5;
     int l[5] = { 1, 10, 100, 1000 , 5000};
 
-    int nf = 4;
-    log_f func[4] = { flog_table, flog_bsgs, flog_crt, flog_gen };
-    char * n[4] = { "table", "bsgs", "crt", "generic" };
+    int nf = 6;
+    log_f func[6] = { flog_table, flog_bsgs, flog_crt, flog_gen, flog_bsgs_big, flog_gen_big };
+    char * n[6] = { "table", "bsgs", "crt", "generic", "bsgs x8", "generic x8" };
 
     int np = NUMPRIMES;
 
@@ -148,7 +197,7 @@ int main(int argc, char *argv[])
                 /* skip useless */
                 if (f == 0 && nbits >= 20)
                     continue;
-                if (f == 1 && nbits >= 30 && l[i] > 10)
+                if ((f == 1 || f == 4) && nbits >= 30 && l[i] > 10)
                     continue;
                 if (out == LOG)
                 {
@@ -173,6 +222,30 @@ int main(int argc, char *argv[])
             }
         }
     }
+
+    /* initialization versus loading a stored precomputation */
+    if (out == LOG)
+    {
+        ulong p, a;
+
+        for (nbits = 20; nbits <= 60; nbits += 20)
+        {
+            p = n_randprime(state, nbits, 0);
+            a = n_primitive_root_prime(p);
+
+            flint_printf("precomputation for 1000 logs mod a prime of size %d\n", nbits);
+            flint_printf("%-20s...   ", "init");
+            fflush(stdout);
+            TIMEIT_ONCE_START
+                finit_gen(p, a, 1000);
+            TIMEIT_ONCE_STOP
+            flint_printf("\n%-20s...   ", "load");
+            fflush(stdout);
+            fload_gen(p, a, 1000);
+            flint_printf("\n");
+        }
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
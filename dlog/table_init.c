@@ -18,7 +18,7 @@ dlog_table_init(dlog_table_t t, ulong a, ulong mod)
     int k;
     ulong ak;
     t->mod = mod;
-    t->table = flint_malloc(mod * sizeof(ulong));
+    t->table = flint_calloc(mod, sizeof(ulong));
     ak = 1; k = 0;
 
     /* warning: do not check a is invertible modulo mod */
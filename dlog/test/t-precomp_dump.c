@@ -0,0 +1,122 @@
+/*
+    Copyright (C) 2026 Fredrik Johansson
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "dlog.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("precomp_dump....");
+    fflush(stdout);
+    flint_randinit(state);
+
+/* assume tmpfile() is broken on windows */
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+
+    for (iter = 0; iter < 500; iter++)
+    {
+        dlog_precomp_t pre1, pre2;
+        ulong p, e, pe, phi, a, num, k;
+        nmod_t mod;
+        FILE * tmp;
+
+        dlog_bsgs_set_table_factor(1 + n_randint(state, 2) * n_randint(state, 10));
+        num = 1 + n_randint(state, 1000);
+
+        if (iter % 2)
+        {
+            /* prime modulus, composite order */
+            p = n_randprime(state, 2 + n_randint(state, 34), 0);
+            a = n_primitive_root_prime(p);
+            pe = p;
+            phi = p - 1;
+            dlog_precomp_n_init(pre1, a, p, p - 1, num);
+        }
+        else
+        {
+            /* prime power modulus */
+            p = n_randprime(state, 2 + n_randint(state, 10), 0);
+            e = 1 + n_randint(state, 3);
+            pe = n_pow(p, e);
+            if (p == 2)
+            {
+                a = 5;
+                phi = (pe <= 4) ? 1 : pe / 4;
+            }
+            else
+            {
+                a = n_primitive_root_prime(p);
+                phi = pe - pe / p;
+            }
+            dlog_precomp_modpe_init(pre1, a, p, e, pe, num);
+        }
+
+        nmod_init(&mod, pe);
+
+        tmp = tmpfile();
+        if (tmp == NULL)
+        {
+            flint_printf("FAIL (creating temporary file)  iter = %wd\n\n", iter);
+            flint_abort();
+        }
+
+        if (dlog_precomp_dump_file(tmp, pre1))
+        {
+            flint_printf("FAIL (dump)  mod = %wu\n\n", pe);
+            flint_abort();
+        }
+
+        fflush(tmp);
+        rewind(tmp);
+
+        if (dlog_precomp_load_file(pre2, tmp))
+        {
+            flint_printf("FAIL (load)  mod = %wu\n\n", pe);
+            flint_abort();
+        }
+
+        fclose(tmp);
+
+        for (k = 0; k < 100; k++)
+        {
+            ulong l, b, x1, x2;
+
+            l = n_randint(state, phi);
+            b = nmod_pow_ui(a, l, mod);
+
+            x1 = dlog_precomp(pre1, b);
+            x2 = dlog_precomp(pre2, b);
+
+            if (x1 != l || x2 != l)
+            {
+                flint_printf("FAIL: log(%wu, %wu) mod %wu\n\n", b, a, pe);
+                flint_printf("expected %wu, got %wu (built), %wu (loaded)\n\n", l, x1, x2);
+                flint_printf("table factor %wu, num %wu\n\n", dlog_bsgs_table_factor(), num);
+                flint_abort();
+            }
+        }
+
+        dlog_precomp_clear(pre1);
+        dlog_precomp_clear(pre2);
+    }
+
+    dlog_bsgs_set_table_factor(1);
+
+#endif
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
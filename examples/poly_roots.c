@@ -13,12 +13,12 @@ int main(int argc, char *argv[])
     fmpz_poly_factor_t fac;
     fmpz_t t;
     acb_ptr roots;
-    slong compd, printd, i, j, deg;
+    slong compd, printd, i, j, deg, num_threads;
     int flags;
 
     if (argc < 2)
     {
-        flint_printf("poly_roots [-refine d] [-print d] <poly>\n\n");
+        flint_printf("poly_roots [-refine d] [-print d] [-threads n] <poly>\n\n");
 
         flint_printf("Isolates all the complex roots of a polynomial with integer coefficients.\n\n");
 
@@ -29,6 +29,9 @@ int main(int argc, char *argv[])
         flint_printf("If -print d is passed, the computed roots are printed to d decimals.\n");
         flint_printf("By default, the roots are not printed.\n\n");
 
+        flint_printf("If -threads n is passed, n threads are used for the root\n");
+        flint_printf("finding iterations and the validation of high-degree factors.\n\n");
+
         flint_printf("The polynomial can be specified by passing the following as <poly>:\n\n");
 
         flint_printf("a <n>          Easy polynomial 1 + 2x + ... + (n+1)x^n\n");
@@ -51,6 +54,7 @@ int main(int argc, char *argv[])
 
     compd = 0;
     printd = 0;
+    num_threads = 1;
     flags = ARB_FMPZ_POLY_ROOTS_VERBOSE;
 
     fmpz_poly_init(f);
@@ -70,6 +74,11 @@ int main(int argc, char *argv[])
             printd = atol(argv[i+1]);
             i++;
         }
+        else if (!strcmp(argv[i], "-threads"))
+        {
+            num_threads = atol(argv[i+1]);
+            i++;
+        }
         else if (!strcmp(argv[i], "a"))
         {
             slong n = atol(argv[i+1]);
@@ -177,6 +186,8 @@ int main(int argc, char *argv[])
         }
     }
 
+    flint_set_num_threads(num_threads);
+
     fmpz_poly_factor_init(fac);
 
     flint_printf("computing squarefree factorization...\n");